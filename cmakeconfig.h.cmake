@@ -3,4 +3,7 @@
 
 #cmakedefine01 PLATFORM_TIZEN
 
+/* lowest level of BROWSER_LOG* messages compiled in */
+#define BROWSER_LOG_LEVEL BROWSER_LOG_LEVEL_@LOG_LEVEL@
+
 #endif
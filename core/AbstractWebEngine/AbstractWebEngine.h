@@ -195,6 +195,24 @@ public:
             bool desktopMode = true,
             TabOrigin origin = TabOrigin::UNKNOWN) = 0;
 
+    /**
+     * Adds tab without creating its web view, the page is not loaded
+     * until the tab is switched to. Used to restore tabs of the last
+     * session, the tab counts and is listed as any other tab.
+     * @param uri uri opened, when the tab is switched to
+     * @param tabId Tab id of the new tab. If boost::none, tab's id will be
+     * generated
+     * @param title title shown until the page is loaded
+     * @param desktopMode true if desktop mode, false if mobile mode
+     * @return TabId of created tab
+     */
+    virtual TabId addDiscardedTab(
+            const std::string& uri,
+            const boost::optional<int> tabId,
+            const std::string& title,
+            bool desktopMode = true,
+            TabOrigin origin = TabOrigin::UNKNOWN) = 0;
+
     /**
      * @param tab id
      * @return returns underlaying UI component
@@ -240,6 +258,14 @@ public:
     virtual std::shared_ptr<tizen_browser::tools::BrowserImage> getSnapshotData(TabId id, int width, int height,
             bool async, tizen_browser::tools::SnapshotType snapshot_type) = 0;
 
+    /**
+     * Requests snapshot of the tab without blocking. Snapshot is captured
+     * and encoded in background and emitted with snapshotCaptured. Requests
+     * for the same tab, made before the snapshot is captured, are coalesced.
+     */
+    virtual void requestSnapshot(TabId id, int width, int height,
+            tizen_browser::tools::SnapshotType snapshot_type) = 0;
+
     /**
      * Get the state of secret mode
      *
@@ -516,10 +542,18 @@ public:
     boost::signals2::signal<void (const std::string&, const std::string&)> setWrongCertificatePem;
 
     /**
-     * Async signal to save snapshot after it is generated.
+     * Async signal to save snapshot after it is generated. Snapshot is
+     * encoded already, it is passed with the tab and page it was taken of.
      */
     boost::signals2::signal<void(std::shared_ptr<tizen_browser::tools::BrowserImage>,
-            tizen_browser::tools::SnapshotType snapshot_type)> snapshotCaptured;
+            tizen_browser::tools::SnapshotType snapshot_type, const TabId&, const std::string& uri)> snapshotCaptured;
+
+    /**
+     * Web view of the background tab was destroyed to save memory. Tab
+     * content (without thumbnail) is passed to be stored, the page is
+     * loaded again, when the tab is switched to.
+     */
+    boost::signals2::signal<void (TabContentPtr)> tabDiscarded;
 
     /**
      * Async signal to inform the redirection has started.
@@ -20,14 +20,56 @@
 #include "browser_config.h"
 #include <string>
 
+// lowest level of messages compiled in, set with LOG_LEVEL in CMake
+#define BROWSER_LOG_LEVEL_DEBUG 0
+#define BROWSER_LOG_LEVEL_INFO 1
+#define BROWSER_LOG_LEVEL_WARN 2
+#define BROWSER_LOG_LEVEL_ERROR 3
+#define BROWSER_LOG_LEVEL_NONE 4
+
+#ifndef BROWSER_LOG_LEVEL
+#define BROWSER_LOG_LEVEL BROWSER_LOG_LEVEL_DEBUG
+#endif
+
 #if !defined(NDEBUG) || PLATFORM(TIZEN)
 
 #include "Logger/Logger.h"
 
-#define BROWSER_LOGD(fmt, args...) tizen_browser::logger::Logger::getInstance().log(tizen_browser::logger::make_message(fmt, ##args))
-#define BROWSER_LOGI(fmt, args...) tizen_browser::logger::Logger::getInstance().log(tizen_browser::logger::make_message(fmt, ##args))
-#define BROWSER_LOGW(fmt, args...) tizen_browser::logger::Logger::getInstance().log(tizen_browser::logger::make_message(fmt, ##args))
-#define BROWSER_LOGE(fmt, args...) tizen_browser::logger::Logger::getInstance().log(tizen_browser::logger::make_message(fmt, ##args))
+// message is formatted only when its level is enabled, on the calling thread,
+// loggers write it on the logger thread
+#define BROWSER_LOG_POST(level, fmt, args...) \
+    do { \
+        if (tizen_browser::logger::Logger::isEnabled(level)) \
+            tizen_browser::logger::Logger::getInstance().post(level, fmt, ##args); \
+    } while(0)
+
+// arguments of messages, which are not compiled in, are still used
+#define BROWSER_LOG_IGNORE(fmt, args...) \
+    do { if (0) tizen_browser::logger::Logger::ignore(fmt, ##args); } while(0)
+
+#if BROWSER_LOG_LEVEL <= BROWSER_LOG_LEVEL_DEBUG
+#define BROWSER_LOGD(fmt, args...) BROWSER_LOG_POST(tizen_browser::logger::LoggerLevel::DEBUG, fmt, ##args)
+#else
+#define BROWSER_LOGD(fmt, args...) BROWSER_LOG_IGNORE(fmt, ##args)
+#endif
+
+#if BROWSER_LOG_LEVEL <= BROWSER_LOG_LEVEL_INFO
+#define BROWSER_LOGI(fmt, args...) BROWSER_LOG_POST(tizen_browser::logger::LoggerLevel::INFO, fmt, ##args)
+#else
+#define BROWSER_LOGI(fmt, args...) BROWSER_LOG_IGNORE(fmt, ##args)
+#endif
+
+#if BROWSER_LOG_LEVEL <= BROWSER_LOG_LEVEL_WARN
+#define BROWSER_LOGW(fmt, args...) BROWSER_LOG_POST(tizen_browser::logger::LoggerLevel::WARN, fmt, ##args)
+#else
+#define BROWSER_LOGW(fmt, args...) BROWSER_LOG_IGNORE(fmt, ##args)
+#endif
+
+#if BROWSER_LOG_LEVEL <= BROWSER_LOG_LEVEL_ERROR
+#define BROWSER_LOGE(fmt, args...) BROWSER_LOG_POST(tizen_browser::logger::LoggerLevel::ERROR, fmt, ##args)
+#else
+#define BROWSER_LOGE(fmt, args...) BROWSER_LOG_IGNORE(fmt, ##args)
+#endif
 
 #define BROWSER_ENABLE_LOG
 
@@ -38,6 +38,7 @@ Config::Config()
     m_data["DB_CERTIFICATE"] = std::string(".browser.certificate.db");
     m_data["DB_QUICKACCESS"] = std::string(".browser.quickaccess.db");
     m_data["DB_PWA"] = std::string(".browser.pwa.db");
+    m_data["DB_FAVICON"] = std::string(".browser.favicon.db");
 
     m_data["TOOLTIP_DELAY"] = 0.05;       // time from mouse in to tooltip show
     m_data["TOOLTIP_HIDE_TIMEOUT"] = 2.0; // time from tooltip show to tooltip hide
@@ -49,6 +50,9 @@ Config::Config()
 
     m_keysValues[CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_HEIGHT] = 315;
     m_keysValues[CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_WIDTH] = 590;
+    // memory budgets of tab images cache, in bytes
+    m_keysValues[CONFIG_KEY::TAB_SERVICE_THUMB_CACHE_SIZE] = 8 * 1024 * 1024;
+    m_keysValues[CONFIG_KEY::TAB_SERVICE_FAVICON_CACHE_SIZE] = 512 * 1024;
     m_keysValues[CONFIG_KEY::FAVORITESERVICE_THUMB_HEIGHT] = 261;
     m_keysValues[CONFIG_KEY::FAVORITESERVICE_THUMB_WIDTH] = 319;
 
@@ -60,6 +64,8 @@ Config::Config()
 #else
     m_keysValues[CONFIG_KEY::URLHISTORYLIST_ITEM_HEIGHT] = 82;
 #endif
+    // autocompletion stages percentiles are logged on suspend
+    m_keysValues[CONFIG_KEY::URLHISTORYLIST_LATENCY_TRACING] = false;
 
     m_keysValues[CONFIG_KEY::WEB_ENGINE_PAGE_OVERVIEW] = true;
     m_keysValues[CONFIG_KEY::WEB_ENGINE_LOAD_IMAGES] = true;
@@ -69,6 +75,10 @@ Config::Config()
     m_keysValues[CONFIG_KEY::WEB_ENGINE_REMEMBER_PASSWORDS] = true;
     m_keysValues[CONFIG_KEY::WEB_ENGINE_AUTOFILL_PROFILE_DATA] = true;
     m_keysValues[CONFIG_KEY::WEB_ENGINE_SCRIPTS_CAN_OPEN_PAGES] = true;
+    // tabs with a web view (renderer process), least recently used are discarded, at least 2
+    m_keysValues[CONFIG_KEY::WEB_ENGINE_LIVE_TABS_MAX] = 4;
+    // web views created ahead in idle time, so new tabs open faster
+    m_keysValues[CONFIG_KEY::WEB_ENGINE_WEBVIEW_POOL_SIZE] = 1;
 
     m_keysValues[CONFIG_KEY::CACHE_ENABLE_VALUE] = EINA_TRUE;
     m_keysValues[CONFIG_KEY::CACHE_FONT_VALUE] = 0;
@@ -21,12 +21,15 @@ enum class CONFIG_KEY
 {
     HISTORY_TAB_SERVICE_THUMB_HEIGHT,
     HISTORY_TAB_SERVICE_THUMB_WIDTH,
+    TAB_SERVICE_THUMB_CACHE_SIZE,
+    TAB_SERVICE_FAVICON_CACHE_SIZE,
     FAVORITESERVICE_THUMB_WIDTH,
     FAVORITESERVICE_THUMB_HEIGHT,
     URLHISTORYLIST_ITEMS_NUMBER_MAX,
     URLHISTORYLIST_ITEMS_VISIBLE_NUMBER_MAX,
     URLHISTORYLIST_KEYWORD_LENGTH_MIN,
     URLHISTORYLIST_ITEM_HEIGHT,
+    URLHISTORYLIST_LATENCY_TRACING,
     WEB_ENGINE_PAGE_OVERVIEW,
     WEB_ENGINE_LOAD_IMAGES,
     WEB_ENGINE_ENABLE_JAVASCRIPT,
@@ -35,6 +38,8 @@ enum class CONFIG_KEY
     WEB_ENGINE_REMEMBER_PASSWORDS,
     WEB_ENGINE_AUTOFILL_PROFILE_DATA,
     WEB_ENGINE_SCRIPTS_CAN_OPEN_PAGES,
+    WEB_ENGINE_LIVE_TABS_MAX,
+    WEB_ENGINE_WEBVIEW_POOL_SIZE,
     CACHE_ENABLE_VALUE,
     CACHE_INTERVAL_VALUE,
     CACHE_FONT_VALUE,
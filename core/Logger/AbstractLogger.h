@@ -24,6 +24,15 @@ namespace tizen_browser
 namespace logger
 {
 
+enum class LoggerLevel {
+	NONE,
+	DEBUG,
+	FATAL,
+	ERROR,
+	WARN,
+	INFO,
+};
+
 /**
   * @brief the interface for specialized loggers
   */
@@ -44,6 +53,16 @@ public:
 	  & @param errorFlag marks the message as an error, can be used by specialized loggers
 	  */
 	virtual void log(const std::string &timeStamp, const std::string &tag, const std::string &msg, bool errorFlag = false) = 0;
+	/**
+	  * @brief Adds a log message of given level, loggers which can mark levels override it
+	  * @param level level of the message
+	  * @param timeStamp the message to log
+	  * @param tag the message to log
+	  * @param msg the message to log
+	  */
+	virtual void logMessage(LoggerLevel level, const std::string &timeStamp, const std::string &tag, const std::string &msg) {
+		log(timeStamp, tag, msg, level == LoggerLevel::ERROR || level == LoggerLevel::FATAL);
+	}
 };
 
 } /* end namespace logger */
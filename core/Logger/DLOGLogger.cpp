@@ -44,8 +44,11 @@ void DLOGLogger::init() {
 
 }
 
-void DLOGLogger::log(const std::string & /*timeStamp*/, const std::string & tag, const std::string & msg, bool /*errorFlag*/) {
-    LoggerLevel level = Logger::getLoggerlevel();
+void DLOGLogger::log(const std::string & timeStamp, const std::string & tag, const std::string & msg, bool errorFlag) {
+    logMessage(errorFlag ? LoggerLevel::ERROR : Logger::getLoggerlevel(), timeStamp, tag, msg);
+}
+
+void DLOGLogger::logMessage(LoggerLevel level, const std::string & /*timeStamp*/, const std::string & tag, const std::string & msg) {
     log_priority priority = DLOG_DEFAULT;
     switch (level) {
         case LoggerLevel::NONE:
@@ -39,6 +39,8 @@ public:
 
     virtual void init();
     virtual void log(const std::string &timeStamp, const std::string &tag,const std::string &msg, bool errorFlag = false);
+    //! maps level of the message to dlog priority
+    virtual void logMessage(LoggerLevel level, const std::string &timeStamp, const std::string &tag, const std::string &msg);
 private:
 };
 
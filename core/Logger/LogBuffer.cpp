@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "browser_config.h"
+#include <cstdint>
+#include <cstring>
+
+#include "LogBuffer.h"
+
+namespace tizen_browser {
+namespace logger {
+
+LogBuffer::LogBuffer(std::size_t capacity)
+	: m_mask(0)
+	, m_writePos(0)
+	, m_readPos(0)
+{
+	std::size_t size = 2;
+	while (size < capacity)
+		size <<= 1;
+	m_cells.reset(new Cell[size]);
+	m_mask = size - 1;
+	// sequence of a cell tells, which write (pos) or read (pos + 1) it waits for
+	for (std::size_t i = 0; i < size; ++i)
+		m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+LogBuffer::Record* LogBuffer::claim(std::size_t& ticket)
+{
+	std::size_t pos = m_writePos.load(std::memory_order_relaxed);
+	for (;;) {
+		Cell& cell = m_cells[pos & m_mask];
+		std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+		std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+		if (diff == 0) {
+			if (m_writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				ticket = pos;
+				return &cell.record;
+			}
+		} else if (diff < 0) {
+			// cell still holds record written one lap before
+			return nullptr;
+		} else {
+			pos = m_writePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void LogBuffer::publish(std::size_t ticket)
+{
+	m_cells[ticket & m_mask].sequence.store(ticket + 1, std::memory_order_release);
+}
+
+bool LogBuffer::read(Record& record)
+{
+	Cell& cell = m_cells[m_readPos & m_mask];
+	if (cell.sequence.load(std::memory_order_acquire) != m_readPos + 1)
+		return false;
+	record.level = cell.record.level;
+	record.time = cell.record.time;
+	std::strncpy(record.message, cell.record.message, MESSAGE_SIZE);
+	cell.sequence.store(m_readPos + m_mask + 1, std::memory_order_release);
+	++m_readPos;
+	return true;
+}
+
+} /* end namespace logger */
+} /* end namespace browser */
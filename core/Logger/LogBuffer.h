@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOG_BUFFER_H
+#define LOG_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <sys/time.h>
+
+#include <boost/noncopyable.hpp>
+
+#include "AbstractLogger.h"
+
+namespace tizen_browser {
+namespace logger {
+
+/**
+ * @brief Bounded ring of log records, written by any thread and read by one.
+ *
+ * Writers do not lock: a record is claimed with a compare and swap, filled
+ * in place and published. When the ring is full the record is not claimed,
+ * writer never waits for the reader.
+ */
+class LogBuffer: boost::noncopyable {
+public:
+	//! longer messages are truncated
+	static const std::size_t MESSAGE_SIZE = 512;
+
+	struct Record {
+		LoggerLevel level;
+		struct timeval time;
+		char message[MESSAGE_SIZE];
+	};
+
+	//! @param capacity number of records, rounded up to a power of two
+	explicit LogBuffer(std::size_t capacity);
+
+	/**
+	 * @brief Claims a free record, it has to be published with the ticket
+	 * before other records are read.
+	 *
+	 * @return record or nullptr, when the ring is full
+	 */
+	Record* claim(std::size_t& ticket);
+	void publish(std::size_t ticket);
+
+	/**
+	 * @brief Reads the oldest record, called by one thread only.
+	 *
+	 * @return false when the oldest record is not published yet
+	 */
+	bool read(Record& record);
+
+private:
+	struct Cell {
+		std::atomic<std::size_t> sequence;
+		Record record;
+	};
+
+	std::unique_ptr<Cell[]> m_cells;
+	std::size_t m_mask;
+	std::atomic<std::size_t> m_writePos;
+	std::size_t m_readPos;
+};
+
+} /* end namespace logger */
+} /* end namespace browser */
+
+#endif
@@ -15,6 +15,10 @@
  */
 
 #include "browser_config.h"
+#include <cerrno>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
 #include <sstream>
 #include <cstring>
 #include <sys/time.h>
@@ -33,6 +37,11 @@ static const std::string LEVEL_INFO_TAG = "Info";
 
 static const std::string LEVEL_TAG_ERROR = "TAG_ERROR";
 
+// messages waiting for the logger thread, about 256kB
+static const std::size_t LOG_BUFFER_CAPACITY = 512;
+
+std::atomic<int> Logger::s_minSeverity(0);
+
 #ifdef LOG_LEVEL
 static const LoggerLevel globalLoggerLevel = Logger::parseLoggerLevel(LOG_LEVEL);
 #else
@@ -44,6 +53,33 @@ Logger &Logger::getInstance() {
 	return instance;
 }
 
+Logger::Logger() :
+		m_projectName("[unset project name]"),
+		m_buffer(LOG_BUFFER_CAPACITY),
+		m_running(false),
+		m_dropped(0),
+		m_posted(0),
+		m_written(0) {
+	sem_init(&m_pending, 0, 0);
+	const char *level = getenv("BROWSER_LOG_LEVEL");
+	if (level) {
+		setLevel(parseLoggerLevel(level));
+	}
+}
+
+Logger::~Logger() {
+	if (m_thread.joinable()) {
+		m_running = false;
+		sem_post(&m_pending);
+		m_thread.join();
+	}
+	sem_destroy(&m_pending);
+}
+
+void Logger::setLevel(LoggerLevel level) {
+	s_minSeverity.store(severity(level), std::memory_order_relaxed);
+}
+
 const LoggerLevel & Logger::getLoggerlevel(){
     return globalLoggerLevel;
 }
@@ -101,10 +137,15 @@ void Logger::init() {
 	for (; it != end; ++it) {
 		(*it)->init();
 	}
+	if (!m_thread.joinable()) {
+		m_running = true;
+		m_thread = std::thread(&Logger::run, this);
+	}
 }
 
 void Logger::log(const std::string &msg, bool errorFlag,
 		LoggerLevel ) {
+	std::lock_guard<std::mutex> lock(m_mutex);
 	std::vector<std::shared_ptr<AbstractLogger> >::iterator it =
 			m_loggers.begin(), end = m_loggers.end();
 	for (; it != end; ++it) {
@@ -112,6 +153,82 @@ void Logger::log(const std::string &msg, bool errorFlag,
 	}
 }
 
+void Logger::post(LoggerLevel level, const char *fmt, ...) {
+	std::size_t ticket = 0;
+	LogBuffer::Record *record = m_buffer.claim(ticket);
+	if (!record) {
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	record->level = level;
+	gettimeofday(&record->time, NULL);
+	va_list ap;
+	va_start(ap, fmt);
+	if (vsnprintf(record->message, sizeof(record->message), fmt, ap) < 0) {
+		record->message[0] = '\0';
+	}
+	va_end(ap);
+	m_buffer.publish(ticket);
+	m_posted.fetch_add(1, std::memory_order_release);
+	sem_post(&m_pending);
+}
+
+void Logger::flush() {
+	unsigned long posted = m_posted.load(std::memory_order_acquire);
+	if (!m_thread.joinable()) {
+		// no logger thread yet, caller reads the buffer
+		LogBuffer::Record record;
+		while (sem_trywait(&m_pending) == 0) {
+			while (!m_buffer.read(record)) {
+				std::this_thread::yield();
+			}
+			write(record);
+		}
+		return;
+	}
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_flushed.wait(lock, [this, posted]() { return m_written >= posted; });
+}
+
+void Logger::run() {
+	LogBuffer::Record record;
+	for (;;) {
+		if (sem_wait(&m_pending) != 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		if (!m_running) {
+			break;
+		}
+		// every message is counted once it is published, but an older
+		// one may be still formatted by other thread
+		while (!m_buffer.read(record)) {
+			std::this_thread::yield();
+		}
+		write(record);
+	}
+	while (m_buffer.read(record)) {
+		write(record);
+	}
+}
+
+void Logger::write(const LogBuffer::Record &record) {
+	const std::string time = timeStamp(record.time);
+	std::lock_guard<std::mutex> lock(m_mutex);
+	unsigned dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+	for (auto &logger : m_loggers) {
+		if (dropped) {
+			logger->logMessage(LoggerLevel::WARN, time, m_tag,
+					std::to_string(dropped) + " log messages dropped, log buffer was full");
+		}
+		logger->logMessage(record.level, time, m_tag, record.message);
+	}
+	++m_written;
+	m_flushed.notify_all();
+}
+
 void Logger::info(const std::string & msg) {
 	if (globalLoggerLevel > LoggerLevel::INFO) {
 		log(msg, false, LoggerLevel::INFO);
@@ -148,15 +265,18 @@ int Logger::registerLogger(AbstractLogger *l) {
 }
 
 std::string Logger::timeStamp() {
-        time_t initializer = time(NULL);
+        struct timeval detail_time;
+        gettimeofday(&detail_time,NULL);
+        return timeStamp(detail_time);
+}
+
+std::string Logger::timeStamp(const struct timeval &detail_time) {
+        time_t initializer = detail_time.tv_sec;
         struct tm b;
         if(localtime_r(&initializer,&b)==NULL){
             return std::string("");
         }
 
-        struct timeval detail_time;
-        gettimeofday(&detail_time,NULL);
-
         char buf[80];
 //	strftime(buf, sizeof(buf), "%d/%m/%y,%T ", brokenTime, detail_time.tv_usec/1000);
         snprintf(buf,  sizeof(buf),"[%d/%d/%d,%d:%d:%d.%ld]", b.tm_year, b.tm_mon, b.tm_mday, b.tm_hour, b.tm_min, b.tm_sec, detail_time.tv_usec/1000);
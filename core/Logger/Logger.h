@@ -17,27 +17,25 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
+#include <semaphore.h>
+#include <sys/time.h>
 
 #include <boost/noncopyable.hpp>
 
 #include "AbstractLogger.h"
+#include "LogBuffer.h"
 
 namespace tizen_browser {
 namespace logger {
 
-enum class LoggerLevel {
-	NONE,
-	DEBUG,
-	FATAL,
-	ERROR,
-	WARN,
-	INFO,
-};
-
 /**
  * @brief This function converts printf-like input to std::string.
  *
@@ -68,13 +66,26 @@ public:
 
 	static const LoggerLevel & getLoggerlevel();
 
+	//! returns true if messages of \a level are logged, checked before a message is formatted
+	static bool isEnabled(LoggerLevel level) {
+		return severity(level) >= s_minSeverity.load(std::memory_order_relaxed);
+	}
+
+	//! sets the lowest level of logged messages, at start it is read from BROWSER_LOG_LEVEL environment variable
+	static void setLevel(LoggerLevel level);
+
+	//! keeps arguments of messages, which are not compiled in, used
+	static void ignore(const char *, ...) { }
+
+	~Logger();
+
 	//! sets project name for future usage in specialized loggers
 	void setProjectName(const char * name);
 
 	//! gets project name, used by specialized loggers to access project name
 	std::string getProjectName() const;
 
-	//! calls init() method for all registered loggers
+	//! calls init() method for all registered loggers and starts the logger thread
 	//! @see AbstractLogger::init()
 	void init();
 
@@ -95,6 +106,21 @@ public:
 	 */
 	void log(const std::string & msg, bool errorFlag = false, LoggerLevel loggerLevel = LoggerLevel::INFO);
 
+	/** @brief Put a printf-like message of \a level to the registered loggers
+	 * asynchronously.
+	 *
+	 * The message is formatted into the log buffer, loggers get it on the
+	 * logger thread, see AbstractLogger::logMessage(). Caller never waits:
+	 * when the buffer is full the message is dropped and counted. Messages
+	 * posted before init() wait in the buffer.
+	 *
+	 * This method is thread safe, it is used by BROWSER_LOG* macros.
+	 */
+	void post(LoggerLevel level, const char * fmt, ...);
+
+	//! waits until messages posted so far are passed to the loggers
+	void flush();
+
 	void info(const std::string & msg);
 
 	void warn(const std::string & msg);
@@ -108,6 +134,7 @@ public:
 	//! set task name as a tag
 	//! @see clearLogTag()
 	inline void setLogTag(const std::string tagName) {
+		std::lock_guard<std::mutex> lock(m_mutex);
 		m_tag = tagName;
 	}
 
@@ -122,19 +149,47 @@ public:
 	//! clears the tag, using an empty string as a tag
 	//! @see setLogTag()
 	inline void clearLogTag() {
+		std::lock_guard<std::mutex> lock(m_mutex);
 		m_tag = "";
 	}
 
 	//! returns timestamp
 	static std::string timeStamp();
+	//! returns timestamp of given time
+	static std::string timeStamp(const struct timeval & time);
 	//! register logger given as a pointer, you can use the method directly or via REGISTER_LOGGER() wrapper
 	int registerLogger(AbstractLogger * l);
 private:
 	//! constructor
-	Logger() :
-			m_projectName("[unset project name]") {
+	Logger();
+
+	//! orders levels from the least severe, DEBUG, to NONE
+	static int severity(LoggerLevel level) {
+		switch (level) {
+		case LoggerLevel::DEBUG:
+			return 0;
+		case LoggerLevel::INFO:
+			return 1;
+		case LoggerLevel::WARN:
+			return 2;
+		case LoggerLevel::ERROR:
+			return 3;
+		case LoggerLevel::FATAL:
+			return 4;
+		case LoggerLevel::NONE:
+		default:
+			return 5;
+		}
 	}
-	;
+
+	//! logger thread, passes posted messages to the loggers
+	void run();
+
+	//! passes a posted message to the loggers
+	void write(const LogBuffer::Record & record);
+
+	//! severity of the lowest logged level
+	static std::atomic<int> s_minSeverity;
 
 	//! stores projectname
 	std::string m_projectName;
@@ -144,6 +199,20 @@ private:
 
 	//! table of registered loggers
 	std::vector<std::shared_ptr<AbstractLogger> > m_loggers;
+
+	//! messages posted, but not passed to the loggers yet
+	LogBuffer m_buffer;
+	//! counts published messages, the logger thread waits for it
+	sem_t m_pending;
+	std::thread m_thread;
+	std::atomic<bool> m_running;
+	std::atomic<unsigned> m_dropped;
+	std::atomic<unsigned long> m_posted;
+
+	//! guards the loggers, the tag and the written counter
+	std::mutex m_mutex;
+	std::condition_variable m_flushed;
+	unsigned long m_written;
 };
 
 } /* end namespace logger */
@@ -20,16 +20,28 @@
 #include "BrowserLogger.h"
 #include "ServiceManager.h"
 #include "ServiceManager_p.h"
+#include "StartupTimeline.h"
 
 namespace tizen_browser
 {
 namespace core
 {
 
+namespace
+{
+/// "service.string": "library.so", libraries are loaded when services are used first
+const std::unordered_map<std::string, std::string> SERVICES_LIBRARIES = {
+#   include "ServicesManifest.h"
+};
+}
+
 ServiceManagerPrivate::ServiceManagerPrivate()
 {
-    findServiceLibs();
-    loadServiceLibs();
+    // without the manifest all services are loaded up front
+    if (SERVICES_LIBRARIES.empty()) {
+        findServiceLibs();
+        loadServiceLibs();
+    }
 }
 
 ServiceManagerPrivate::~ServiceManagerPrivate()
@@ -76,6 +88,33 @@ void ServiceManagerPrivate::enumerateServices(){
         BROWSER_LOGD("%s:%p", sm.first.c_str(), sm.second);
 }
 
+ServiceFactory* ServiceManagerPrivate::getFactory(const std::string& service)
+{
+    auto factory = servicesMap.find(service);
+    if (factory != servicesMap.end())
+        return factory->second;
+
+    auto library = SERVICES_LIBRARIES.find(service);
+    if (library == SERVICES_LIBRARIES.end()) {
+        BROWSER_LOGE("[%s:%d] unknown service: %s", __PRETTY_FUNCTION__, __LINE__, service.c_str());
+        return nullptr;
+    }
+
+    tools::ScopedStartupEvent event("load " + service);
+    const std::string path = boost::any_cast<std::string>(
+        tizen_browser::config::Config::getInstance().get("services/dir")) + "/" + library->second;
+    try {
+        auto loader = std::make_shared<ServiceLoader>(path);
+        auto serviceFactory = loader->getFactory();
+        servicesLoaderMap[path] = loader;
+        servicesMap[service] = serviceFactory;
+        return serviceFactory;
+    } catch (const std::runtime_error& e) {
+        BROWSER_LOGE("[%s:%d] %s", __PRETTY_FUNCTION__, __LINE__, e.what());
+    }
+    return nullptr;
+}
+
 ServiceManager::ServiceManager()
     :d(new ServiceManagerPrivate)
 {}
@@ -95,8 +134,13 @@ std::shared_ptr< AbstractService > ServiceManager::getService(const std::string&
     std::lock_guard<std::mutex> hold(mut);
     auto sp = cache[service];
 
-    if (!sp)
-        cache[service] = sp = std::shared_ptr<AbstractService>(d->servicesMap[service]->create());
+    if (!sp) {
+        auto factory = d->getFactory(service);
+        if (!factory)
+            return sp;
+        tools::ScopedStartupEvent event("create " + service);
+        cache[service] = sp = std::shared_ptr<AbstractService>(factory->create());
+    }
     return sp;
 }
 
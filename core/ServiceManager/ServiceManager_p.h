@@ -48,6 +48,12 @@ private:
      */
     void enumerateServices();/// write names of all services
 
+    /**
+     * Returns factory of the service, its library is loaded on first use.
+     * nullptr if the service is unknown or cannot be loaded.
+     */
+    ServiceFactory* getFactory(const std::string& service);
+
     //ServiceFactory is a static ServiceFactory member - no need to delete it manually (or by smart_ptr) by calling delete or free on it
     std::unordered_map<std::string, ServiceFactory*> servicesMap; /// "com.class.interface":&ServiceFactory
     std::unordered_map<std::string, std::shared_ptr<ServiceLoader>>  servicesLoaderMap; /// "path/to/library.so": &service_factory_interface
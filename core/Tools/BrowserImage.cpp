@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 
 #include "browser_config.h"
@@ -29,7 +30,6 @@ BrowserImage::BrowserImage() :
         m_dataSize(0),
         m_isSharedData(false),
         m_imageType(ImageType::ImageTypeNoImage),
-        m_imageData(nullptr),
         m_colorSpace(EVAS_COLORSPACE_ARGB8888)
 {}
 
@@ -39,12 +39,12 @@ BrowserImage::BrowserImage(const int& w, const int& h, const long& s) :
         m_dataSize(s),
         m_isSharedData(false),
         m_imageType(ImageType::ImageTypeNoImage),
-        m_imageData(nullptr),
         m_colorSpace(EVAS_COLORSPACE_ARGB8888)
 {}
 
 BrowserImage::BrowserImage(Evas_Object* image) :
-        m_imageData(nullptr)
+        m_isSharedData(false),
+        m_imageType(ImageType::ImageTypeNoImage)
 {
     evas_object_image_size_get(image, &m_width, &m_height);
 
@@ -69,36 +69,33 @@ BrowserImage::BrowserImage(const BrowserImage& copy) :
         m_width(copy.getWidth()),
         m_height(copy.getHeight()),
         m_dataSize(copy.getSize()),
-        m_isSharedData(false),
-        m_imageType(ImageType::ImageTypeNoImage),
-        m_imageData(nullptr),
-        m_colorSpace(copy.getColorSpace())
+        m_isSharedData(copy.isSharedData()),
+        m_imageType(copy.getImageType()),
+        m_imageData(copy.m_imageData),
+        m_colorSpace(copy.getColorSpace()),
+        m_decoded(copy.m_decoded)
 {
-    setData(copy.getData(), copy.isSharedData(), copy.getImageType());
 }
 
-
-
 void BrowserImage::setData(void* data, bool isSharedData, ImageType type)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    if (m_imageData) {
-        free(m_imageData);
-        m_imageData = nullptr;
-    }
+    m_imageData.reset();
+    m_decoded.reset();
     m_imageType = ImageType::ImageTypeNoImage;
     if (!data) {
         m_dataSize = 0;
         return;
     }
     if (isSharedData) {
-        m_imageData = data;
+        m_imageData = Buffer(data, [](const void*) {});
         m_imageType = type;
     } else {
         if (m_dataSize > 0) {
-            m_imageData = malloc(m_dataSize);
-            if (m_imageData) {
-                std::memcpy(m_imageData, data, m_dataSize);
+            void* copy = malloc(m_dataSize);
+            if (copy) {
+                std::memcpy(copy, data, m_dataSize);
+                m_imageData = Buffer(copy, [](const void* p) { free(const_cast<void*>(p)); });
                 m_imageType = type;
             } else {
                 m_dataSize = 0;
@@ -108,13 +105,33 @@ void BrowserImage::setData(void* data, bool isSharedData, ImageType type)
     m_isSharedData = isSharedData;
 }
 
+void BrowserImage::takeData(void* data, ImageType type)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    m_decoded.reset();
+    if (data)
+        m_imageData = Buffer(data, [](const void* p) { free(const_cast<void*>(p)); });
+    else
+        m_imageData.reset();
+    m_imageType = data ? type : ImageType::ImageTypeNoImage;
+    m_isSharedData = false;
+    if (!data)
+        m_dataSize = 0;
+}
+
+bool BrowserImage::isEncoded() const
+{
+    return m_imageType == ImageType::ImageTypePNG || m_imageType == ImageType::ImageTypeJPEG;
+}
+
 Evas_Object* BrowserImage::getEvasImage(Evas_Object* parent) const
 {
     switch (m_imageType) {
         case ImageType::ImageTypeEvasObject:
             return getEvas(parent);
         case ImageType::ImageTypePNG:
-            return getPng(parent);
+        case ImageType::ImageTypeJPEG:
+            return getEncoded(parent);
         case ImageType::ImageTypeNoImage:
         default:
             return nullptr;
@@ -122,16 +139,75 @@ Evas_Object* BrowserImage::getEvasImage(Evas_Object* parent) const
 }
 
 Evas_Object* BrowserImage::getEvas(Evas_Object* parent) const
+{
+    if (!m_imageData)
+        return nullptr;
+    return createImage(parent, m_imageData, m_width, m_height, m_colorSpace);
+}
+
+Evas_Object* BrowserImage::getEncoded(Evas_Object * parent) const
+{
+    auto pixels = m_decoded.lock();
+    if (!pixels) {
+        pixels = decode(parent);
+        if (!pixels)
+            return nullptr;
+        m_decoded = pixels;
+    }
+    // objects keep the decoded image through its pixels
+    return createImage(parent, Buffer(pixels, pixels->data.get()), pixels->width, pixels->height,
+        EVAS_COLORSPACE_ARGB8888);
+}
+
+std::shared_ptr<BrowserImage::Pixels> BrowserImage::decode(Evas_Object* parent) const
+{
+    if (!m_dataSize || !m_imageData || !isEncoded())
+        return nullptr;
+
+    Evas * e = evas_object_evas_get(parent);
+    Evas_Object * image = evas_object_image_add(e);
+    // images read from databases are always marked as PNG, so JPEG
+    // is recognized by its signature
+    const unsigned char* bytes = static_cast<const unsigned char*>(m_imageData.get());
+    bool jpeg = m_dataSize > 2 && bytes[0] == 0xFF && bytes[1] == 0xD8;
+    char png_format[] = "png";
+    char jpeg_format[] = "jpeg";
+    evas_object_image_memfile_set(image, const_cast<void*>(m_imageData.get()), m_dataSize,
+        jpeg ? jpeg_format : png_format, NULL);
+    Evas_Load_Error error = evas_object_image_load_error_get(image);
+    if (EINA_UNLIKELY(error != EVAS_LOAD_ERROR_NONE)) {
+        BROWSER_LOGE("[%s:%d] Can't decode image: %s", __PRETTY_FUNCTION__, __LINE__, evas_load_error_str(error));
+        evas_object_del(image);
+        return nullptr;
+    }
+
+    auto pixels = std::make_shared<Pixels>();
+    evas_object_image_size_get(image, &pixels->width, &pixels->height);
+    const int stride = evas_object_image_stride_get(image);
+    const int rowSize = pixels->width * sizeof(uint32_t);
+    const unsigned char* decoded = static_cast<const unsigned char*>(evas_object_image_data_get(image, EINA_FALSE));
+    unsigned char* data = decoded && pixels->height > 0 ?
+        static_cast<unsigned char*>(malloc(rowSize * pixels->height)) : nullptr;
+    if (data) {
+        for (int row = 0; row < pixels->height; ++row)
+            std::memcpy(data + row * rowSize, decoded + row * stride, rowSize);
+        pixels->data = Buffer(data, [](const void* p) { free(const_cast<void*>(p)); });
+    }
+    evas_object_del(image);
+    return data ? pixels : nullptr;
+}
+
+Evas_Object* BrowserImage::createImage(Evas_Object* parent, Buffer pixels, int width, int height,
+    Evas_Colorspace colorSpace)
 {
     Evas * e = evas_object_evas_get(parent);
     Evas_Object * eo_image = evas_object_image_filled_add(e);
 
-    evas_object_image_size_set(eo_image, m_width, m_height);
-    evas_object_image_colorspace_set(eo_image, m_colorSpace);
-    void* data = evas_object_image_data_get(eo_image, EINA_TRUE);
-    memcpy(data, m_imageData, m_dataSize);
-    evas_object_image_data_set(eo_image, data);
+    evas_object_image_size_set(eo_image, width, height);
+    evas_object_image_colorspace_set(eo_image, colorSpace);
     evas_object_image_alpha_set(eo_image, EINA_TRUE);
+    // pixels are not copied, evas object keeps them until it is deleted
+    evas_object_image_data_set(eo_image, const_cast<void*>(pixels.get()));
 
     Evas_Load_Error err = evas_object_image_load_error_get(eo_image);
     if (err != EVAS_LOAD_ERROR_NONE) {
@@ -139,37 +215,17 @@ Evas_Object* BrowserImage::getEvas(Evas_Object* parent) const
         evas_object_del(eo_image);
         return nullptr;
     }
+    evas_object_event_callback_add(eo_image, EVAS_CALLBACK_DEL, releasePixels, new Buffer(std::move(pixels)));
 
-    evas_object_image_fill_set(eo_image, 0, 0, m_width, m_height);
+    evas_object_image_fill_set(eo_image, 0, 0, width, height);
     return eo_image;
 }
 
-Evas_Object* BrowserImage::getPng(Evas_Object * parent) const
-{
-    if(m_dataSize && m_imageData && m_imageType == ImageType::ImageTypePNG) {
-        Evas * e = evas_object_evas_get(parent);
-        Evas_Object * image = evas_object_image_filled_add(e);
-        char png_format[] = "png";
-        evas_object_image_memfile_set(image, m_imageData, m_dataSize, png_format, NULL);
-        Evas_Load_Error error = evas_object_image_load_error_get(image);
-        if (EINA_UNLIKELY(error != EVAS_LOAD_ERROR_NONE)) {
-            BROWSER_LOGE("[%s:%d] Can't decode image: %s", __PRETTY_FUNCTION__, __LINE__, evas_load_error_str(error));
-            evas_object_del(image);
-            return nullptr;
-        }
-        return image;
-    }
-    return nullptr;
-}
-
-BrowserImage::~BrowserImage()
+void BrowserImage::releasePixels(void* data, Evas*, Evas_Object* obj, void*)
 {
-    if (m_imageData && !m_isSharedData) {
-        free(m_imageData);
-        m_imageData = nullptr;
-    }
+    evas_object_image_data_set(obj, nullptr);
+    delete static_cast<Buffer*>(data);
 }
 
-
 } /* end of namespace tools */
 } /* end of namespace tizen_browser */
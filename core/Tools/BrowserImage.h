@@ -28,7 +28,8 @@ enum class ImageType {
     ImageTypeNoImage,
     ImageTypeSerializedEvas,
     ImageTypeEvasObject,
-    ImageTypePNG
+    ImageTypePNG,
+    ImageTypeJPEG
 };
 
 class BrowserImage
@@ -36,16 +37,21 @@ class BrowserImage
 public:
     BrowserImage();
     BrowserImage(const int& w, const int& h, const long& s);
+    /**
+     * Copies pixels of @p image, they belong to the evas object
+     */
     BrowserImage(Evas_Object* image);
+    /**
+     * Shares data of @p copy, data is never modified so it is not copied
+     */
     BrowserImage(const BrowserImage& copy);
-    ~BrowserImage();
 
     /**
      * Sets image raw data pointer, type and memory share
      *
      * If isSharedData is true that means data is in shared memory
      * and it will not be released, otherwise data will be copied
-     * and free in object destructor
+     * and free when the image and all its copies are destroyed
      *
      * @param[in] data pointer to image data
      * @param[in] isSharedData true if @p data points to shared memory
@@ -54,9 +60,23 @@ public:
     void setData(void* data, bool isSharedData, ImageType type);
 
     /**
-     * @return image data pointer, should not be released
+     * Takes ownership of @p data without copying it
+     *
+     * @param[in] data buffer of getSize() bytes allocated with malloc,
+     * released when the image and all its copies are destroyed
+     * @param[in] type Image type
      */
-    void* getData() const { return m_imageData; };
+    void takeData(void* data, ImageType type);
+
+    /**
+     * @return true if data is compressed (PNG or JPEG)
+     */
+    bool isEncoded() const;
+
+    /**
+     * @return image data pointer, should not be released or modified
+     */
+    const void* getData() const { return m_imageData.get(); };
     ImageType getImageType() const { return m_imageType; };
     void setWidth(const int& w) { m_width = w; };
     int getWidth() const { return m_width; };
@@ -70,22 +90,42 @@ public:
     /**
      * Function create new Evas_Object* representing stored image
      *
+     * Evas object shows pixels of the image without copying them. Compressed
+     * image is decoded once, objects created while its decoded pixels are
+     * shown by other objects share them.
+     *
      * @param[in] parent parent view
      * @return new Evas_Object* representing image or nullptr on fail
      */
     Evas_Object* getEvasImage(Evas_Object* parent) const;
 
 private:
+    using Buffer = std::shared_ptr<const void>;
+
+    struct Pixels
+    {
+        int width;
+        int height;
+        Buffer data;
+    };
+
     Evas_Object* getEvas(Evas_Object* parent) const;
-    Evas_Object* getPng(Evas_Object* parent) const;
+    Evas_Object* getEncoded(Evas_Object* parent) const;
+    std::shared_ptr<Pixels> decode(Evas_Object* parent) const;
+    static Evas_Object* createImage(Evas_Object* parent, Buffer pixels, int width, int height,
+        Evas_Colorspace colorSpace);
+    static void releasePixels(void* data, Evas* e, Evas_Object* obj, void* event_info);
 
     int m_width;
     int m_height;
     long m_dataSize;
     bool m_isSharedData;
     ImageType m_imageType;
-    void * m_imageData;
+    // immutable, shared by copies of the image and evas objects showing it
+    Buffer m_imageData;
     Evas_Colorspace m_colorSpace;
+    // decoded compressed image, alive while evas objects show it
+    mutable std::weak_ptr<Pixels> m_decoded;
 };
 
 using BrowserImagePtr = std::shared_ptr<BrowserImage>;
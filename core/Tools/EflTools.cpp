@@ -19,6 +19,8 @@
  * Created on: May, 2014
  *     Author: k.dobkowski
  */
+#include <algorithm>
+#include <cstdlib>
 #include <image_util.h>
 #include <BrowserAssert.h>
 
@@ -47,57 +49,80 @@ std::unique_ptr<Blob> getBlobPNG(std::shared_ptr<BrowserImage> browserImage)
         &length);
     if (!mem_buffer || !length) {
         BROWSER_LOGW("Cannot create BlobPNG");
+        free(mem_buffer);
         return nullptr;
     }
     std::unique_ptr<Blob> image(new Blob(mem_buffer, length));
+    free(mem_buffer);
     return std::move(image);
 }
 
-void* getBlobPNG(int width, int height, void* image_data, unsigned long long* length)
+std::unique_ptr<Blob> getBlob(std::shared_ptr<BrowserImage> browserImage)
 {
     BROWSER_LOGD("[%s:%d]", __PRETTY_FUNCTION__, __LINE__);
+    if (browserImage && browserImage->isEncoded()) {
+        if (!browserImage->getData() || browserImage->getSize() <= 0)
+            return nullptr;
+        return std::unique_ptr<Blob>(new Blob(browserImage->getData(), browserImage->getSize()));
+    }
+    return getBlobPNG(browserImage);
+}
+
+// level is PNG compression or JPEG quality
+static void* encode(image_util_type_e type, int width, int height, const void* image_data, int level,
+    unsigned long long* length)
+{
     EINA_SAFETY_ON_NULL_RETURN_VAL(image_data, NULL);
 
     image_util_encode_h handler = nullptr;
     unsigned char* outputBuffer = nullptr;
 
-    if (image_util_encode_create(IMAGE_UTIL_PNG, &handler) < 0) {
+    if (image_util_encode_create(type, &handler) < 0) {
         BROWSER_LOGW("[%s:%d] image_util_encode_create: error!", __PRETTY_FUNCTION__, __LINE__);
         return nullptr;
     }
 
-    if (image_util_encode_set_png_compression(handler, IMAGE_UTIL_PNG_COMPRESSION_6) < 0) {
+    bool result = false;
+    if (type == IMAGE_UTIL_PNG && image_util_encode_set_png_compression(handler,
+            static_cast<image_util_png_compression_e>(level)) < 0) {
         BROWSER_LOGW("[%s:%d] image_util_encode_set_png_compression: error!", __PRETTY_FUNCTION__, __LINE__);
-        return nullptr;
-    }
-
-    if (image_util_encode_set_resolution(handler, width, height) < 0) {
+    } else if (type == IMAGE_UTIL_JPEG && image_util_encode_set_quality(handler, level) < 0) {
+        BROWSER_LOGW("[%s:%d] image_util_encode_set_quality: error!", __PRETTY_FUNCTION__, __LINE__);
+    } else if (image_util_encode_set_resolution(handler, width, height) < 0) {
         BROWSER_LOGW("[%s:%d] image_util_encode_set_resolution: error!", __PRETTY_FUNCTION__, __LINE__);
-        return nullptr;
-    }
-
-    if (image_util_encode_set_input_buffer(handler, (const unsigned char*) image_data) < 0) {
+    } else if (image_util_encode_set_input_buffer(handler, (const unsigned char*) image_data) < 0) {
         BROWSER_LOGW("[%s:%d] image_util_encode_set_input_buffer: error!", __PRETTY_FUNCTION__, __LINE__);
-        return nullptr;
-    }
-
-    if (image_util_encode_set_output_buffer(handler, &outputBuffer) < 0) {
+    } else if (image_util_encode_set_output_buffer(handler, &outputBuffer) < 0) {
         BROWSER_LOGW("[%s:%d] image_util_encode_set_output_buffer: error!", __PRETTY_FUNCTION__, __LINE__);
-        return nullptr;
-    }
-
-    if (image_util_encode_run(handler, length) < 0) {
+    } else if (image_util_encode_run(handler, length) < 0) {
         BROWSER_LOGW("[%s:%d] image_util_encode_run: error!", __PRETTY_FUNCTION__, __LINE__);
-        return nullptr;
+    } else {
+        result = true;
     }
 
-    if (image_util_encode_destroy(handler) < 0) {
-        BROWSER_LOGW("[%s:%d] mage_util_encode_destroy: error!", __PRETTY_FUNCTION__, __LINE__);
+    if (image_util_encode_destroy(handler) < 0)
+        BROWSER_LOGW("[%s:%d] image_util_encode_destroy: error!", __PRETTY_FUNCTION__, __LINE__);
+
+    if (!result) {
+        free(outputBuffer);
         return nullptr;
     }
     return outputBuffer;
 }
 
+void* getBlobPNG(int width, int height, const void* image_data, unsigned long long* length, int compression)
+{
+    BROWSER_LOGD("[%s:%d]", __PRETTY_FUNCTION__, __LINE__);
+    return encode(IMAGE_UTIL_PNG, width, height, image_data,
+        std::max<int>(IMAGE_UTIL_PNG_COMPRESSION_0, std::min<int>(compression, IMAGE_UTIL_PNG_COMPRESSION_9)), length);
+}
+
+void* getBlobJPEG(int width, int height, const void* image_data, int quality, unsigned long long* length)
+{
+    BROWSER_LOGD("[%s:%d]", __PRETTY_FUNCTION__, __LINE__);
+    return encode(IMAGE_UTIL_JPEG, width, height, image_data, quality, length);
+}
+
 void setExpandHints(Evas_Object* toSet)
 {
     evas_object_size_hint_weight_set(toSet, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
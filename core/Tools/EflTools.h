@@ -48,7 +48,23 @@ namespace tools {
 namespace EflTools {
 
     std::unique_ptr<Blob> getBlobPNG(BrowserImagePtr browserImage);
-    void* getBlobPNG(int width, int height, void * image_data, unsigned long long* length);
+    /**
+     * Encode raw image data as PNG with compression level 0-9, buffer has
+     * to be released with free().
+     */
+    void* getBlobPNG(int width, int height, const void * image_data, unsigned long long* length,
+        int compression = 6);
+
+    /**
+     * Encode raw image data as JPEG, buffer has to be released with free().
+     */
+    void* getBlobJPEG(int width, int height, const void * image_data, int quality, unsigned long long* length);
+
+    /**
+     * Get image data to be stored in a database: encoded images are copied
+     * as they are, raw images are encoded as PNG.
+     */
+    std::unique_ptr<Blob> getBlob(BrowserImagePtr browserImage);
 
     void setExpandHints(Evas_Object* toSet);
 
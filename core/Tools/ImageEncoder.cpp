@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+#include <Ecore.h>
+#include "browser_config.h"
+#include "BrowserLogger.h"
+#include "EflTools.h"
+#include "ImageEncoder.h"
+
+namespace tizen_browser {
+namespace tools {
+
+// good enough for thumbnails, artifacts are not visible after scaling
+const ImageEncoder::Format ImageEncoder::SNAPSHOT = {ImageType::ImageTypeJPEG, 75};
+// favicons are small and keep sharp edges, so they are lossless
+const ImageEncoder::Format ImageEncoder::FAVICON = {ImageType::ImageTypePNG, 6};
+
+/**
+ * State shared with results queued in the main loop. They may outlive
+ * the encoder, so it is kept alive by them.
+ */
+struct ImageEncoder::Shared
+{
+    Shared()
+        : alive(true)
+        , sequence(0)
+    {
+    }
+
+    /// true if there is no newer request with the key and it is not cancelled
+    bool current(const std::string& key, unsigned number)
+    {
+        if (key.empty())
+            return true;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = latest.find(key);
+        return it != latest.end() && it->second == number;
+    }
+
+    // accessed from the main loop only
+    bool alive;
+    std::mutex mutex;
+    unsigned sequence;
+    // number of the newest request of each key
+    std::unordered_map<std::string, unsigned> latest;
+};
+
+struct ImageEncoder::Job
+{
+    BrowserImagePtr image;
+    Callback callback;
+    Format format;
+    std::string key;
+    unsigned number;
+};
+
+struct ImageEncoder::Result
+{
+    std::shared_ptr<Shared> shared;
+    BrowserImagePtr image;
+    Callback callback;
+    std::string key;
+    unsigned number;
+};
+
+ImageEncoder::ImageEncoder(std::size_t threads)
+    : m_shared(std::make_shared<Shared>())
+    , m_quit(false)
+{
+    threads = std::max<std::size_t>(threads, 1);
+    for (std::size_t i = 0; i < threads; ++i)
+        m_threads.emplace_back(&ImageEncoder::run, this);
+}
+
+ImageEncoder::~ImageEncoder()
+{
+    m_shared->alive = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+        m_jobs.clear();
+    }
+    m_condition.notify_all();
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+void ImageEncoder::encode(BrowserImagePtr image, Callback callback, const Format& format,
+    const std::string& key)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        unsigned number = 0;
+        if (!key.empty()) {
+            std::lock_guard<std::mutex> sharedLock(m_shared->mutex);
+            number = ++m_shared->sequence;
+            m_shared->latest[key] = number;
+            m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(),
+                [&key](const Job& job) { return job.key == key; }), m_jobs.end());
+        }
+        m_jobs.push_back(Job{image, callback, format, key, number});
+    }
+    m_condition.notify_one();
+}
+
+void ImageEncoder::cancel(const std::string& key)
+{
+    if (key.empty())
+        return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    {
+        std::lock_guard<std::mutex> sharedLock(m_shared->mutex);
+        m_shared->latest.erase(key);
+    }
+    m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(),
+        [&key](const Job& job) { return job.key == key; }), m_jobs.end());
+}
+
+BrowserImagePtr ImageEncoder::encodeSync(BrowserImagePtr image, const Format& format)
+{
+    if (!image || image->getImageType() != ImageType::ImageTypeEvasObject
+            || image->getColorSpace() != EVAS_COLORSPACE_ARGB8888)
+        return image;
+
+    unsigned long long length = 0;
+    void* data = nullptr;
+    if (format.type == ImageType::ImageTypePNG)
+        data = EflTools::getBlobPNG(image->getWidth(), image->getHeight(), image->getData(), &length,
+            format.level);
+    else
+        data = EflTools::getBlobJPEG(image->getWidth(), image->getHeight(), image->getData(), format.level,
+            &length);
+    if (!data || !length) {
+        BROWSER_LOGW("[%s:%d] image not encoded", __PRETTY_FUNCTION__, __LINE__);
+        free(data);
+        return image;
+    }
+
+    auto encoded = std::make_shared<BrowserImage>(image->getWidth(), image->getHeight(), length);
+    encoded->takeData(data, format.type);
+    BROWSER_LOGD("[%s:%d] %ldB -> %lluB", __PRETTY_FUNCTION__, __LINE__, image->getSize(), length);
+    return encoded;
+}
+
+void ImageEncoder::run()
+{
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_quit || !m_jobs.empty(); });
+            if (m_quit)
+                return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        // superseded while it was waiting for this thread
+        if (!m_shared->current(job.key, job.number))
+            continue;
+
+        BrowserImagePtr image = encodeSync(job.image, job.format);
+        ecore_main_loop_thread_safe_call_async(ImageEncoder::deliverResult,
+                new Result{m_shared, image, job.callback, job.key, job.number});
+    }
+}
+
+void ImageEncoder::deliverResult(void* data)
+{
+    std::unique_ptr<Result> result(static_cast<Result*>(data));
+    if (!result->shared->alive)
+        return;
+    if (!result->key.empty()) {
+        std::lock_guard<std::mutex> lock(result->shared->mutex);
+        auto it = result->shared->latest.find(result->key);
+        if (it == result->shared->latest.end() || it->second != result->number)
+            return;
+        result->shared->latest.erase(it);
+    }
+    result->callback(result->image);
+}
+
+} /* namespace tools */
+} /* namespace tizen_browser */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef IMAGEENCODER_H_
+#define IMAGEENCODER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BrowserImage.h"
+
+namespace tizen_browser {
+namespace tools {
+
+/**
+ * @brief Compresses raw images on a pool of worker threads.
+ *
+ * Snapshots and favicons from web views are raw ARGB buffers. They are
+ * encoded (snapshots as JPEG, favicons as PNG) before they are cached and
+ * stored in databases, so the main loop is not blocked by compression.
+ * Encoded image is passed to the callback from the main loop
+ * (ecore_main_loop_thread_safe_call_async). With one thread, callbacks are
+ * called in order of requests.
+ *
+ * Requests may be given a key (e.g. tab id or url). A newer request with
+ * the same key supersedes the older one, which is then dropped or, if it is
+ * already encoded, its callback is not called.
+ */
+class ImageEncoder
+{
+public:
+    using Callback = std::function<void (BrowserImagePtr)>;
+
+    struct Format
+    {
+        /// ImageTypeJPEG or ImageTypePNG
+        ImageType type;
+        /// JPEG quality (1-100) or PNG compression level (0-9)
+        int level;
+    };
+    static const Format SNAPSHOT;
+    static const Format FAVICON;
+
+    explicit ImageEncoder(std::size_t threads = 1);
+    ~ImageEncoder();
+
+    /**
+     * @brief Schedules encoding of the image.
+     *
+     * Image must not be modified until callback is called. If image
+     * cannot be encoded, callback gets it unchanged.
+     *
+     * @param key requests with the same non-empty key supersede each other
+     */
+    void encode(BrowserImagePtr image, Callback callback, const Format& format = SNAPSHOT,
+        const std::string& key = std::string());
+
+    /**
+     * @brief Drops the request with given key, its callback is not called.
+     */
+    void cancel(const std::string& key);
+
+    /**
+     * @brief Encodes the image on the calling thread.
+     *
+     * @return encoded image or @p image, if it cannot be encoded
+     */
+    static BrowserImagePtr encodeSync(BrowserImagePtr image, const Format& format = SNAPSHOT);
+
+private:
+    struct Shared;
+    struct Job;
+    struct Result;
+
+    void run();
+    static void deliverResult(void* data);
+
+    std::shared_ptr<Shared> m_shared;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<Job> m_jobs;
+    bool m_quit;
+    std::vector<std::thread> m_threads;
+};
+
+} /* namespace tools */
+} /* namespace tizen_browser */
+
+#endif /* IMAGEENCODER_H_ */
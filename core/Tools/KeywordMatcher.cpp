@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "BrowserLogger.h"
+#include "KeywordMatcher.h"
+
+namespace tizen_browser {
+namespace tools {
+
+const std::size_t KeywordMatcher::MAX_KEYWORDS;
+
+KeywordMatcher::KeywordMatcher()
+    : KeywordMatcher(std::vector<std::string>())
+{
+}
+
+KeywordMatcher::KeywordMatcher(const std::vector<std::string>& keywords)
+    : m_shortest(0)
+    , m_longest(0)
+    , m_classesCount(1)
+    , m_startBytesCount(0)
+{
+    std::fill(m_classes, m_classes + 256, 0);
+    std::fill(m_start, m_start + 256, false);
+
+    for (const auto& keyword : keywords) {
+        if (keyword.empty())
+            continue;
+        std::string folded(keyword);
+        for (auto& c : folded)
+            c = fold(c);
+        if (std::find(m_keywords.begin(), m_keywords.end(), folded) != m_keywords.end())
+            continue;
+        if (m_keywords.size() == MAX_KEYWORDS) {
+            BROWSER_LOGW("[%s:%d] too many keywords, ignoring: %s", __PRETTY_FUNCTION__, __LINE__, keyword.c_str());
+            continue;
+        }
+        m_keywords.push_back(std::move(folded));
+    }
+    if (m_keywords.empty()) {
+        m_next.assign(1, 0);
+        m_output.assign(1, 0);
+        return;
+    }
+
+    // letters of both cases share the class of the lowercase letter
+    std::size_t trieSize = 1;
+    m_shortest = m_keywords.front().length();
+    for (const auto& keyword : m_keywords) {
+        m_shortest = std::min(m_shortest, keyword.length());
+        m_longest = std::max(m_longest, keyword.length());
+        trieSize += keyword.length();
+        for (unsigned char c : keyword)
+            if (!m_classes[c])
+                m_classes[c] = m_classesCount++;
+    }
+    for (unsigned c = 'A'; c <= 'Z'; ++c)
+        m_classes[c] = m_classes[fold(c)];
+
+    // trie, missing transitions are marked with 0, as root is never a target
+    m_next.assign(trieSize * m_classesCount, 0);
+    m_output.assign(trieSize, 0);
+    State states = 1;
+    for (std::size_t i = 0; i < m_keywords.size(); ++i) {
+        State state = 0;
+        for (unsigned char c : m_keywords[i]) {
+            State& next = m_next[state * m_classesCount + m_classes[c]];
+            if (!next)
+                next = states++;
+            state = next;
+        }
+        m_output[state] |= Mask(1) << i;
+    }
+
+    // breadth first, turn trie into automaton: missing transitions follow
+    // the longest proper suffix (failure link), which is already complete
+    std::vector<State> fail(states, 0);
+    std::vector<State> queue;
+    queue.reserve(states);
+    for (std::size_t c = 0; c < m_classesCount; ++c)
+        if (m_next[c])
+            queue.push_back(m_next[c]);
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const State state = queue[head];
+        m_output[state] |= m_output[fail[state]];
+        for (std::size_t c = 0; c < m_classesCount; ++c) {
+            State& next = m_next[state * m_classesCount + c];
+            const State failNext = m_next[fail[state] * m_classesCount + c];
+            if (next) {
+                fail[next] = failNext;
+                queue.push_back(next);
+            } else {
+                next = failNext;
+            }
+        }
+    }
+
+    std::vector<unsigned char> startBytes;
+    for (unsigned c = 0; c < 256; ++c)
+        if (m_next[m_classes[c]]) {
+            m_start[c] = true;
+            startBytes.push_back(c);
+        }
+    // a single letter (both cases) or at most two other bytes are found
+    // with memchr, which is vectorized by libc, more with the lookup table
+    if (startBytes.size() <= 2) {
+        m_startBytesCount = startBytes.size();
+        std::copy(startBytes.begin(), startBytes.end(), m_startBytes);
+    }
+    m_next.resize(states * m_classesCount);
+    m_output.resize(states);
+}
+
+bool KeywordMatcher::matchesAll(const char* text, std::size_t length) const
+{
+    if (m_keywords.empty())
+        return true;
+    if (length < m_longest)
+        return false;
+    const Mask all = (m_keywords.size() == MAX_KEYWORDS) ?
+            ~Mask(0) : (Mask(1) << m_keywords.size()) - 1;
+    Mask found = 0;
+    scan(text, length, [&found, all](Mask matched, std::size_t) {
+        found |= matched;
+        return found != all;
+    });
+    return found == all;
+}
+
+bool KeywordMatcher::matchesAny(const char* text, std::size_t length) const
+{
+    bool found = false;
+    scan(text, length, [&found](Mask, std::size_t) {
+        found = true;
+        return false;
+    });
+    return found;
+}
+
+} /* namespace tools */
+} /* namespace tizen_browser */
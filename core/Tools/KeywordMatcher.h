@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef KEYWORDMATCHER_H_
+#define KEYWORDMATCHER_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace tizen_browser {
+namespace tools {
+
+/**
+ * @brief Searches text for several keywords at once, ignoring ASCII case.
+ *
+ * Keywords are compiled once into an Aho-Corasick automaton over case folded
+ * bytes, so every text is scanned in a single pass, without building
+ * lowercased copies and without any allocation. While no keyword is
+ * partially matched, scanning jumps straight to the next byte which can
+ * start a keyword (with memchr, when there are at most two such bytes).
+ *
+ * Empty keywords are ignored, duplicates are merged. Only the first
+ * MAX_KEYWORDS distinct keywords are used.
+ */
+class KeywordMatcher
+{
+public:
+    static const std::size_t MAX_KEYWORDS = 64;
+
+    KeywordMatcher();
+    explicit KeywordMatcher(const std::vector<std::string>& keywords);
+
+    /// number of distinct keywords
+    std::size_t size() const { return m_keywords.size(); }
+    bool empty() const { return m_keywords.empty(); }
+
+    /// lowercased keyword, indexes are the ones passed to forEachMatch
+    const std::string& keyword(std::size_t index) const { return m_keywords[index]; }
+
+    /**
+     * @brief Checks if text contains all keywords, true if there are no keywords.
+     */
+    bool matchesAll(const char* text, std::size_t length) const;
+    bool matchesAll(const std::string& text) const
+    {
+        return matchesAll(text.data(), text.length());
+    }
+
+    /**
+     * @brief Checks if text contains at least one keyword.
+     */
+    bool matchesAny(const char* text, std::size_t length) const;
+    bool matchesAny(const std::string& text) const
+    {
+        return matchesAny(text.data(), text.length());
+    }
+
+    /**
+     * @brief Calls function(keyword, begin, end) for every occurrence of every
+     * keyword in text, ordered by the end position. Occurrences may overlap.
+     */
+    template <typename Function>
+    void forEachMatch(const std::string& text, Function function) const
+    {
+        scan(text.data(), text.length(),
+                [this, &function](Mask matched, std::size_t end) {
+                    for (std::size_t i = 0; matched; ++i, matched >>= 1)
+                        if (matched & 1)
+                            function(i, end - m_keywords[i].length(), end);
+                    return true;
+                });
+    }
+
+private:
+    using Mask = std::uint64_t;
+    using State = std::uint32_t;
+
+    static unsigned char fold(unsigned char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? c | 0x20 : c;
+    }
+
+    /**
+     * Runs the automaton over text and calls onMatch(mask, end) with
+     * keywords ending at every position, stops if onMatch returns false.
+     */
+    template <typename OnMatch>
+    void scan(const char* text, std::size_t length, OnMatch onMatch) const;
+
+    const unsigned char* skipToStart(const unsigned char* pos,
+            const unsigned char* end, const unsigned char** hits) const;
+
+    std::vector<std::string> m_keywords;
+    std::size_t m_shortest;
+    std::size_t m_longest;
+    // byte -> alphabet class, 0 for bytes not found in any keyword
+    unsigned char m_classes[256];
+    std::size_t m_classesCount;
+    // dense transition table, m_classesCount entries per state
+    std::vector<State> m_next;
+    // keywords ending in every state, including ones ending in its suffixes
+    std::vector<Mask> m_output;
+    // bytes, which can start a keyword
+    bool m_start[256];
+    unsigned char m_startBytes[2];
+    std::size_t m_startBytesCount;
+};
+
+template <typename OnMatch>
+void KeywordMatcher::scan(const char* text, std::size_t length,
+        OnMatch onMatch) const
+{
+    if (m_keywords.empty() || length < m_shortest)
+        return;
+    const unsigned char* begin = reinterpret_cast<const unsigned char*>(text);
+    const unsigned char* end = begin + length;
+    const unsigned char* hits[2] = {nullptr, nullptr};
+    State state = 0;
+    for (const unsigned char* pos = begin; pos < end; ++pos) {
+        if (state == 0) {
+            pos = skipToStart(pos, end, hits);
+            if (pos == end)
+                return;
+        }
+        state = m_next[state * m_classesCount + m_classes[*pos]];
+        if (m_output[state] && !onMatch(m_output[state], pos + 1 - begin))
+            return;
+    }
+}
+
+inline const unsigned char* KeywordMatcher::skipToStart(
+        const unsigned char* pos, const unsigned char* end,
+        const unsigned char** hits) const
+{
+    if (!m_startBytesCount) {
+        while (pos < end && !m_start[*pos])
+            ++pos;
+        return pos;
+    }
+    // hits cache the next occurrence of every start byte, so each memchr
+    // pass over the text is done once
+    const unsigned char* next = end;
+    for (std::size_t i = 0; i < m_startBytesCount; ++i) {
+        if (!hits[i] || hits[i] < pos) {
+            const void* hit = std::memchr(pos, m_startBytes[i], end - pos);
+            hits[i] = hit ? static_cast<const unsigned char*>(hit) : end;
+        }
+        if (hits[i] < next)
+            next = hits[i];
+    }
+    return next;
+}
+
+} /* namespace tools */
+} /* namespace tizen_browser */
+
+#endif /* KEYWORDMATCHER_H_ */
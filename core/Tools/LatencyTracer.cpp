@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "BrowserLogger.h"
+#include "LatencyTracer.h"
+
+namespace tizen_browser {
+namespace tools {
+
+namespace {
+
+// nearest-rank percentile of sorted values
+double percentile(const std::vector<double>& sorted, double percent)
+{
+    std::size_t rank = static_cast<std::size_t>(percent / 100.0 * sorted.size() + 0.5);
+    rank = std::min(std::max<std::size_t>(rank, 1), sorted.size());
+    return sorted[rank - 1];
+}
+
+} /* namespace */
+
+const std::size_t LatencyTracer::SAMPLES_MAX;
+
+LatencyTracer::LatencyTracer()
+    : m_enabled(false)
+{
+}
+
+void LatencyTracer::record(const std::string& stage, Clock::duration duration)
+{
+    if (!m_enabled)
+        return;
+    const double ms = std::chrono::duration<double, std::milli>(duration).count();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Samples& samples = m_samples[stage];
+    if (samples.values.size() < SAMPLES_MAX) {
+        samples.values.push_back(ms);
+    } else {
+        samples.values[samples.next] = ms;
+        samples.next = (samples.next + 1) % SAMPLES_MAX;
+    }
+}
+
+void LatencyTracer::start(const std::string& stage)
+{
+    if (!m_enabled)
+        return;
+    const Clock::time_point now = Clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_started[stage] = now;
+}
+
+void LatencyTracer::stop(const std::string& stage)
+{
+    if (!m_enabled)
+        return;
+    const Clock::time_point now = Clock::now();
+    Clock::time_point begin;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_started.find(stage);
+        if (it == m_started.end())
+            return;
+        begin = it->second;
+        m_started.erase(it);
+    }
+    record(stage, now - begin);
+}
+
+LatencyTracer::Stats LatencyTracer::getStats(const std::string& stage) const
+{
+    std::vector<double> sorted;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_samples.find(stage);
+        if (it != m_samples.end())
+            sorted = it->second.values;
+    }
+    if (sorted.empty())
+        return Stats{0, 0.0, 0.0, 0.0, 0.0};
+    std::sort(sorted.begin(), sorted.end());
+    return Stats{sorted.size(), percentile(sorted, 50), percentile(sorted, 95),
+            percentile(sorted, 99), sorted.back()};
+}
+
+std::vector<std::string> LatencyTracer::getStages() const
+{
+    std::vector<std::string> stages;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& samples : m_samples)
+        stages.push_back(samples.first);
+    return stages;
+}
+
+void LatencyTracer::dump() const
+{
+    for (const auto& stage : getStages()) {
+        const Stats stats = getStats(stage);
+        BROWSER_LOGD("[%s:%d] %s: n=%zu p50=%.3fms p95=%.3fms p99=%.3fms max=%.3fms",
+                __PRETTY_FUNCTION__, __LINE__, stage.c_str(), stats.count,
+                stats.p50, stats.p95, stats.p99, stats.max);
+    }
+}
+
+void LatencyTracer::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_samples.clear();
+    m_started.clear();
+}
+
+} /* namespace tools */
+} /* namespace tizen_browser */
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LATENCYTRACER_H_
+#define LATENCYTRACER_H_
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tizen_browser {
+namespace tools {
+
+/**
+ * Stages of url autocompletion, from an url entry edit to the suggestions
+ * list update.
+ */
+namespace autocomplete_stage {
+// whole way, from the keystroke to suggestions shown
+const char* const KEYSTROKE = "autocomplete";
+const char* const URL_ENTRY_EDITED = "SimpleUI::onURLEntryEditedByUser";
+const char* const HISTORY_SEARCH = "HistoryService::getHistoryItemsByKeywordsString";
+const char* const MATCH_INDEX_FIND = "HistoryMatchIndex::find";
+const char* const REMOVE_MISMATCHES = "removeMismatches";
+const char* const REMOVE_URL_DUPLICATES = "removeUrlDuplicates";
+const char* const HIGHLIGHT = "UrlMatchesStyler::getUrlHighlightedMatches";
+const char* const PREPARE_URLS = "GenlistManager::prepareUrlsVector";
+} /* namespace autocomplete_stage */
+
+/**
+ * @brief Collects durations of named stages and reports their percentiles.
+ *
+ * Every stage keeps only its last SAMPLES_MAX samples, so memory use is
+ * bounded. Stages can be recorded from any thread. Tracing is disabled by
+ * default, recording then costs a single atomic read.
+ */
+class LatencyTracer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static const std::size_t SAMPLES_MAX = 1024;
+
+    struct Stats
+    {
+        std::size_t count;
+        // milliseconds
+        double p50;
+        double p95;
+        double p99;
+        double max;
+    };
+
+    static LatencyTracer& getInstance()
+    {
+        static LatencyTracer instance;
+        return instance;
+    }
+    LatencyTracer(LatencyTracer const&) = delete;
+    void operator=(LatencyTracer const&) = delete;
+
+    void setEnabled(bool enabled) { m_enabled = enabled; }
+    bool isEnabled() const { return m_enabled; }
+
+    /**
+     * @brief Adds sample of the stage.
+     */
+    void record(const std::string& stage, Clock::duration duration);
+
+    /**
+     * @brief Marks beginning of the stage, which ends in another place
+     * (or thread). Marking it again restarts it.
+     */
+    void start(const std::string& stage);
+
+    /**
+     * @brief Records the stage started with start(). Does nothing, if the
+     * stage was not started or is already stopped.
+     */
+    void stop(const std::string& stage);
+
+    /**
+     * @brief Returns percentiles of the stage samples, all zeros if there
+     * are no samples.
+     */
+    Stats getStats(const std::string& stage) const;
+
+    /// names of stages with samples, sorted
+    std::vector<std::string> getStages() const;
+
+    /**
+     * @brief Logs percentiles of all stages.
+     */
+    void dump() const;
+
+    /**
+     * @brief Removes all samples and started stages.
+     */
+    void reset();
+
+private:
+    struct Samples
+    {
+        std::vector<double> values;
+        // position of the next sample, when values are full
+        std::size_t next = 0;
+    };
+
+    LatencyTracer();
+
+    std::atomic<bool> m_enabled;
+    mutable std::mutex m_mutex;
+    std::map<std::string, Samples> m_samples;
+    std::map<std::string, Clock::time_point> m_started;
+};
+
+/**
+ * @brief Records duration of its own scope as a stage of LatencyTracer.
+ */
+class ScopedLatency
+{
+public:
+    explicit ScopedLatency(const char* stage)
+        : m_stage(LatencyTracer::getInstance().isEnabled() ? stage : nullptr)
+        , m_begin(m_stage ? LatencyTracer::Clock::now() : LatencyTracer::Clock::time_point())
+    {
+    }
+    ~ScopedLatency()
+    {
+        if (m_stage)
+            LatencyTracer::getInstance().record(m_stage,
+                    LatencyTracer::Clock::now() - m_begin);
+    }
+    ScopedLatency(ScopedLatency const&) = delete;
+    void operator=(ScopedLatency const&) = delete;
+
+private:
+    const char* m_stage;
+    LatencyTracer::Clock::time_point m_begin;
+};
+
+} /* namespace tools */
+} /* namespace tizen_browser */
+
+#endif /* LATENCYTRACER_H_ */
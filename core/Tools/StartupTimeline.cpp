@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "BrowserLogger.h"
+#include "StartupTimeline.h"
+
+namespace tizen_browser {
+namespace tools {
+
+StartupTimeline::StartupTimeline()
+    : m_dumped(false)
+{
+}
+
+void StartupTimeline::record(const std::string& event, Clock::time_point begin)
+{
+    const Event recorded{event, begin, Clock::now() - begin};
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_events.empty() && !m_dumped)
+        m_origin = begin;
+    // events may end in other order, than they began
+    if (begin < m_origin)
+        m_origin = begin;
+    if (m_dumped)
+        log(recorded);
+    else
+        m_events.push_back(recorded);
+}
+
+void StartupTimeline::dump()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_dumped)
+        return;
+    m_dumped = true;
+    std::stable_sort(m_events.begin(), m_events.end(),
+        [](const Event& left, const Event& right) { return left.begin < right.begin; });
+    BROWSER_LOGI("[startup] %zu events, begin and duration in ms:", m_events.size());
+    for (const auto& event : m_events)
+        log(event);
+    m_events.clear();
+}
+
+void StartupTimeline::log(const Event& event) const
+{
+    using ms = std::chrono::duration<double, std::milli>;
+    BROWSER_LOGI("[startup] %8.1f %8.1f %s", ms(event.begin - m_origin).count(),
+        ms(event.duration).count(), event.name.c_str());
+}
+
+} /* namespace tools */
+} /* namespace tizen_browser */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STARTUPTIMELINE_H_
+#define STARTUPTIMELINE_H_
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tizen_browser {
+namespace tools {
+
+/**
+ * @brief Timeline of the application startup: loading, creation and
+ * initialization of services.
+ *
+ * Events are kept until the first frame is ready and logged together by
+ * dump(), with their begin relative to the first recorded event. Events
+ * recorded later (services loaded on demand) are logged at once.
+ */
+class StartupTimeline
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static StartupTimeline& getInstance()
+    {
+        static StartupTimeline instance;
+        return instance;
+    }
+    StartupTimeline(StartupTimeline const&) = delete;
+    void operator=(StartupTimeline const&) = delete;
+
+    /**
+     * @brief Adds the event, which began at begin and ends now.
+     */
+    void record(const std::string& event, Clock::time_point begin);
+
+    /**
+     * @brief Logs all events recorded so far, the startup is over then.
+     */
+    void dump();
+
+private:
+    struct Event
+    {
+        std::string name;
+        Clock::time_point begin;
+        Clock::duration duration;
+    };
+
+    StartupTimeline();
+    void log(const Event& event) const;
+
+    std::mutex m_mutex;
+    Clock::time_point m_origin;
+    bool m_dumped;
+    std::vector<Event> m_events;
+};
+
+/**
+ * @brief Records its own scope as a StartupTimeline event.
+ */
+class ScopedStartupEvent
+{
+public:
+    explicit ScopedStartupEvent(const std::string& event)
+        : m_event(event)
+        , m_begin(StartupTimeline::Clock::now())
+    {
+    }
+    ~ScopedStartupEvent()
+    {
+        StartupTimeline::getInstance().record(m_event, m_begin);
+    }
+    ScopedStartupEvent(ScopedStartupEvent const&) = delete;
+    void operator=(ScopedStartupEvent const&) = delete;
+
+private:
+    std::string m_event;
+    StartupTimeline::Clock::time_point m_begin;
+};
+
+} /* namespace tools */
+} /* namespace tizen_browser */
+
+#endif /* STARTUPTIMELINE_H_ */
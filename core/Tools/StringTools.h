@@ -49,6 +49,7 @@ unsigned getLongest(const vector<string>& strings);
 /**
  * @brief checks if string contains given pattern
  * E.g. (abcd, bc) -> true, (abcd, ad) -> false
+ * For case insensitive search of several keywords use KeywordMatcher.
  *
  * @param text checked text
  * @param pattern checked pattern
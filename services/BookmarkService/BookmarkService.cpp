@@ -130,7 +130,7 @@ std::shared_ptr<BookmarkItem> BookmarkService::addBookmark(
 
     std::shared_ptr<BookmarkItem> bookmark = std::make_shared<BookmarkItem>(id, address, title, note, dirId, order);
     if (thumbnail && thumbnail->getSize() > 0){
-        std::unique_ptr<tizen_browser::tools::Blob> thumb_blob = tizen_browser::tools::EflTools::getBlobPNG(thumbnail);
+        std::unique_ptr<tizen_browser::tools::Blob> thumb_blob = tizen_browser::tools::EflTools::getBlob(thumbnail);
         if (thumb_blob){
             unsigned char * thumb = std::move((unsigned char*)thumb_blob->getData());
             bp_bookmark_adaptor_set_snapshot(id, thumbnail->getWidth(), thumbnail->getHeight(), thumb, thumb_blob->getLength());
@@ -163,7 +163,11 @@ void BookmarkService::updateBookmarkItemSnapshot(const std::string & url, tools:
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     int id = getBookmarkId(url);
     if (id != 0 && snapshot) {
-        std::unique_ptr<tools::Blob> snapshot_blob = tools::EflTools::getBlobPNG(snapshot);
+        std::unique_ptr<tools::Blob> snapshot_blob = tools::EflTools::getBlob(snapshot);
+        if (!snapshot_blob) {
+            BROWSER_LOGW("getBlob failed");
+            return;
+        }
         unsigned char * snap = std::move((unsigned char*)snapshot_blob->getData());
         if (bp_bookmark_adaptor_set_snapshot(id, snapshot->getWidth(), snapshot->getHeight(), snap,
                 snapshot_blob->getLength()) < 0)
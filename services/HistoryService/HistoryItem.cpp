@@ -66,6 +66,8 @@ HistoryItem::HistoryItem(const HistoryItem& source)
     , m_title(source.m_title)
     , m_lastVisit(source.m_lastVisit)
     , m_favIcon(source.m_favIcon)
+    , m_thumbnailLoader(source.m_thumbnailLoader)
+    , m_favIconLoader(source.m_favIconLoader)
     , m_visitCounter(source.m_visitCounter)
 {
 
@@ -84,6 +86,8 @@ HistoryItem & HistoryItem::operator=(HistoryItem && other) noexcept
         m_visitDate = std::move(other.m_visitDate);
         m_visitCounter = std::move(other.m_visitCounter);
         m_favIcon = std::move(other.m_favIcon);
+        m_thumbnailLoader = std::move(other.m_thumbnailLoader);
+        m_favIconLoader = std::move(other.m_favIconLoader);
     }
     return *this;
 }
@@ -152,24 +156,43 @@ int HistoryItem::getVisitCounter()
 void HistoryItem::setFavIcon(tools::BrowserImagePtr favIcon)
 {
     m_favIcon = favIcon;
+    m_favIconLoader = nullptr;
 }
 
-tools::BrowserImagePtr HistoryItem::getFavIcon()
+tools::BrowserImagePtr HistoryItem::getFavIcon() const
 {
+    if (m_favIconLoader) {
+        m_favIcon = m_favIconLoader();
+        m_favIconLoader = nullptr;
+    }
     return m_favIcon;
 }
 
+void HistoryItem::setFavIconLoader(ImageLoader loader)
+{
+    m_favIconLoader = loader;
+}
+
 void HistoryItem::setThumbnail(tools::BrowserImagePtr thumbnail)
 {
     m_thumbnail = thumbnail;
+    m_thumbnailLoader = nullptr;
 };
 
 tools::BrowserImagePtr HistoryItem::getThumbnail() const
 {
-
+    if (m_thumbnailLoader) {
+        m_thumbnail = m_thumbnailLoader();
+        m_thumbnailLoader = nullptr;
+    }
     return m_thumbnail;
 };
 
+void HistoryItem::setThumbnailLoader(ImageLoader loader)
+{
+    m_thumbnailLoader = loader;
+}
+
 void HistoryItem::setUriFavicon(const std::string & uri) {
     m_urifavicon = uri;
 }
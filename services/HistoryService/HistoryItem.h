@@ -19,6 +19,7 @@
 
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -29,6 +30,8 @@ namespace services {
 
 class HistoryItem {
 public:
+    using ImageLoader = std::function<tools::BrowserImagePtr ()>;
+
     HistoryItem(int id,
                 const std::string & url,
                 const std::string & title,
@@ -65,8 +68,19 @@ public:
     void setThumbnail(tools::BrowserImagePtr thumbnail);
     tools::BrowserImagePtr getThumbnail() const;
 
+    /**
+     * @brief Sets function loading thumbnail on the first getThumbnail()
+     * call, so metadata-only items do not keep images in memory.
+     */
+    void setThumbnailLoader(ImageLoader loader);
+
     void setFavIcon(tools::BrowserImagePtr favIcon);
-    tools::BrowserImagePtr getFavIcon();
+    tools::BrowserImagePtr getFavIcon() const;
+
+    /**
+     * @brief Sets function loading favicon on the first getFavIcon() call.
+     */
+    void setFavIconLoader(ImageLoader loader);
 
     void setUriFavicon(const std::string & uri);
     std::string getUriFavicon();
@@ -78,8 +92,10 @@ private:
     std::string m_title;
     boost::gregorian::date m_visitDate;
     boost::posix_time::ptime m_lastVisit;
-    tools::BrowserImagePtr m_thumbnail;
-    tools::BrowserImagePtr m_favIcon;
+    mutable tools::BrowserImagePtr m_thumbnail;
+    mutable tools::BrowserImagePtr m_favIcon;
+    mutable ImageLoader m_thumbnailLoader;
+    mutable ImageLoader m_favIconLoader;
     std::string m_urifavicon;
     int m_visitCounter;
 };
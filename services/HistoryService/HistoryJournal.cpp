@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include "BrowserLogger.h"
+#include "HistoryJournal.h"
+
+namespace tizen_browser {
+namespace services {
+
+HistoryJournal::HistoryJournal(Write write, std::chrono::milliseconds delay)
+    : m_write(write)
+    , m_delay(delay)
+    , m_flushRequested(false)
+    , m_writing(false)
+    , m_quit(false)
+    , m_thread(&HistoryJournal::run, this)
+{
+}
+
+HistoryJournal::~HistoryJournal()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_condition.notify_one();
+    // pending entries are written before the thread ends
+    m_thread.join();
+}
+
+HistoryJournal::Entry& HistoryJournal::entry(const std::string& url)
+{
+    auto found = std::find_if(m_pending.begin(), m_pending.end(),
+        [&url](const Entry& entry) { return entry.url == url; });
+    if (found != m_pending.end())
+        return *found;
+    if (m_pending.empty())
+        m_deadline = std::chrono::steady_clock::now() + m_delay;
+    m_pending.push_back(Entry{url, std::string(), 0, nullptr, nullptr});
+    return m_pending.back();
+}
+
+void HistoryJournal::visit(const std::string& url, const std::string& title, tools::BrowserImagePtr favicon)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Entry& visited = entry(url);
+        ++visited.visits;
+        visited.title = title;
+        if (favicon)
+            visited.favicon = favicon;
+    }
+    m_condition.notify_one();
+}
+
+void HistoryJournal::setFavicon(const std::string& url, tools::BrowserImagePtr favicon)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry(url).favicon = favicon;
+    }
+    m_condition.notify_one();
+}
+
+void HistoryJournal::setSnapshot(const std::string& url, tools::BrowserImagePtr snapshot)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry(url).snapshot = snapshot;
+    }
+    m_condition.notify_one();
+}
+
+void HistoryJournal::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_pending.empty() && !m_writing)
+        return;
+    BROWSER_LOGD("[%s:%d] entries: %zu", __PRETTY_FUNCTION__, __LINE__, m_pending.size());
+    m_flushRequested = true;
+    m_condition.notify_one();
+    m_written.wait(lock, [this]() { return m_pending.empty() && !m_writing; });
+    m_flushRequested = false;
+}
+
+void HistoryJournal::discard()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pending.clear();
+    m_written.wait(lock, [this]() { return !m_writing; });
+}
+
+void HistoryJournal::run()
+{
+    for (;;) {
+        std::vector<Entry> batch;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_quit || !m_pending.empty(); });
+            if (m_pending.empty())
+                return;
+            // more updates of the page come during its load
+            m_condition.wait_until(lock, m_deadline, [this]() { return m_quit || m_flushRequested; });
+            // discarded meanwhile
+            if (m_pending.empty())
+                continue;
+            batch.swap(m_pending);
+            m_writing = true;
+        }
+
+        BROWSER_LOGD("[%s:%d] writing entries: %zu", __PRETTY_FUNCTION__, __LINE__, batch.size());
+        m_write(batch);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_writing = false;
+        }
+        m_written.notify_all();
+    }
+}
+
+} /* namespace services */
+} /* namespace tizen_browser */
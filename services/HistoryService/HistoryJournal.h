@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HISTORYJOURNAL_H_
+#define HISTORYJOURNAL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BrowserImage.h"
+
+namespace tizen_browser {
+namespace services {
+
+/**
+ * @brief Write-behind journal of history updates.
+ *
+ * Visits, favicons and snapshots of the same url, which come within the
+ * delay, are merged into one entry. Entries are written in batches on a
+ * worker thread, so the database is not accessed, while the page is
+ * loaded. Pending entries are written, when the journal is flushed or
+ * destroyed.
+ */
+class HistoryJournal
+{
+public:
+    struct Entry
+    {
+        std::string url;
+        std::string title;
+        // number of visits, 0 if only images are updated
+        int visits;
+        tools::BrowserImagePtr favicon;
+        tools::BrowserImagePtr snapshot;
+    };
+    /// writes the batch, called on the worker thread
+    using Write = std::function<void (const std::vector<Entry>&)>;
+
+    HistoryJournal(Write write, std::chrono::milliseconds delay);
+    ~HistoryJournal();
+
+    void visit(const std::string& url, const std::string& title, tools::BrowserImagePtr favicon);
+    void setFavicon(const std::string& url, tools::BrowserImagePtr favicon);
+    void setSnapshot(const std::string& url, tools::BrowserImagePtr snapshot);
+
+    /**
+     * @brief Writes pending entries at once and waits, until they are
+     * written.
+     */
+    void flush();
+
+    /**
+     * @brief Drops pending entries and waits, until the batch being
+     * written is done. Used before the history is deleted.
+     */
+    void discard();
+
+private:
+    Entry& entry(const std::string& url);
+    void run();
+
+    Write m_write;
+    const std::chrono::milliseconds m_delay;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::condition_variable m_written;
+    std::vector<Entry> m_pending;
+    std::chrono::steady_clock::time_point m_deadline;
+    bool m_flushRequested;
+    bool m_writing;
+    bool m_quit;
+    std::thread m_thread;
+};
+
+} /* namespace services */
+} /* namespace tizen_browser */
+
+#endif /* HISTORYJOURNAL_H_ */
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <boost/algorithm/string.hpp>
+#include "Tools/KeywordMatcher.h"
+#include "HistoryMatchIndex.h"
+#include "HistoryServiceTools.h"
+
+namespace tizen_browser {
+namespace services {
+
+namespace {
+
+const std::size_t TRIGRAM_LENGTH = 3;
+
+// match weights, depending on where the keyword was found
+const double WEIGHT_HOST_PREFIX = 4.0;
+const double WEIGHT_HOST = 2.0;
+const double WEIGHT_URL = 1.0;
+// recency weight halves every RECENCY_HALF_LIFE, but never drops below
+// RECENCY_FLOOR, so frequently visited old pages still can win
+const double RECENCY_HALF_LIFE = 7 * 24 * 60 * 60;
+const double RECENCY_FLOOR = 0.1;
+
+
+double frecency(double matchWeight, int frequency, std::time_t lastVisit,
+        std::time_t now)
+{
+    const double age = std::max(0.0, std::difftime(now, lastVisit));
+    const double recency = RECENCY_FLOOR + std::pow(0.5, age / RECENCY_HALF_LIFE);
+    return matchWeight * (1.0 + std::log1p(std::max(0, frequency))) * recency;
+}
+
+struct Candidate
+{
+    int id;
+    double score;
+    std::time_t lastVisit;
+};
+
+// true if a is ranked better than b
+bool rankedBefore(const Candidate& a, const Candidate& b)
+{
+    if (a.score != b.score)
+        return a.score > b.score;
+    if (a.lastVisit != b.lastVisit)
+        return a.lastVisit > b.lastVisit;
+    return a.id > b.id;
+}
+
+} /* namespace */
+
+std::size_t HistoryMatchIndex::EntryKeyHash::operator()(const Entry* entry) const
+{
+    // FNV-1a, hashes the key in place, without copying it
+    std::size_t hash = 2166136261u;
+    for (std::size_t i = entry->hostBegin; i < entry->keyEnd; ++i) {
+        hash ^= static_cast<unsigned char>(entry->url[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool HistoryMatchIndex::EntryKeyEqual::operator()(const Entry* a,
+        const Entry* b) const
+{
+    const std::size_t length = a->keyEnd - a->hostBegin;
+    return length == b->keyEnd - b->hostBegin
+            && a->url.compare(a->hostBegin, length, b->url, b->hostBegin, length) == 0;
+}
+
+HistoryMatchIndex::HistoryMatchIndex()
+{
+}
+
+std::vector<HistoryMatchIndex::Trigram> HistoryMatchIndex::trigrams(
+        const std::string& str)
+{
+    std::vector<Trigram> result;
+    if (str.length() < TRIGRAM_LENGTH)
+        return result;
+    result.reserve(str.length() - TRIGRAM_LENGTH + 1);
+    for (std::size_t i = 0; i + TRIGRAM_LENGTH <= str.length(); ++i)
+        result.push_back(
+                static_cast<Trigram>(static_cast<unsigned char>(str[i])) << 16 |
+                static_cast<Trigram>(static_cast<unsigned char>(str[i + 1])) << 8 |
+                static_cast<Trigram>(static_cast<unsigned char>(str[i + 2])));
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void HistoryMatchIndex::addPostings(int id, const std::string& url)
+{
+    for (auto trigram : trigrams(url)) {
+        Postings& postings = m_postings[trigram];
+        // ids are usually growing, so appending is the common case
+        if (postings.empty() || postings.back() < id) {
+            postings.push_back(id);
+        } else {
+            auto it = std::lower_bound(postings.begin(), postings.end(), id);
+            if (it == postings.end() || *it != id)
+                postings.insert(it, id);
+        }
+    }
+}
+
+void HistoryMatchIndex::removePostings(int id, const std::string& url)
+{
+    for (auto trigram : trigrams(url)) {
+        auto itPostings = m_postings.find(trigram);
+        if (itPostings == m_postings.end())
+            continue;
+        Postings& postings = itPostings->second;
+        auto it = std::lower_bound(postings.begin(), postings.end(), id);
+        if (it != postings.end() && *it == id)
+            postings.erase(it);
+        if (postings.empty())
+            m_postings.erase(itPostings);
+    }
+}
+
+void HistoryMatchIndex::insert(int id, const std::string& url,
+        std::time_t lastVisit, int frequency)
+{
+    remove(id);
+    std::string lowerUrl(boost::algorithm::to_lower_copy(url));
+    addPostings(id, lowerUrl);
+
+    std::size_t hostBegin, keyEnd;
+    getUrlDuplicateKeyRange(lowerUrl, hostBegin, keyEnd);
+    std::size_t hostEnd = lowerUrl.find('/', hostBegin);
+    if (hostEnd == std::string::npos)
+        hostEnd = lowerUrl.length();
+
+    m_entries[id] = Entry{std::move(lowerUrl), lastVisit, frequency, hostBegin, hostEnd, keyEnd};
+}
+
+void HistoryMatchIndex::visit(int id, std::time_t lastVisit)
+{
+    auto it = m_entries.find(id);
+    if (it != m_entries.end()) {
+        it->second.lastVisit = lastVisit;
+        ++it->second.frequency;
+    }
+}
+
+void HistoryMatchIndex::setFrequency(int id, int frequency)
+{
+    auto it = m_entries.find(id);
+    if (it != m_entries.end())
+        it->second.frequency = frequency;
+}
+
+void HistoryMatchIndex::remove(int id)
+{
+    auto it = m_entries.find(id);
+    if (it == m_entries.end())
+        return;
+    removePostings(id, it->second.url);
+    m_entries.erase(it);
+}
+
+void HistoryMatchIndex::clear()
+{
+    m_entries.clear();
+    m_postings.clear();
+}
+
+bool HistoryMatchIndex::collectCandidates(const std::string& keyword,
+        std::vector<int>& candidates) const
+{
+    const std::vector<Trigram> keywordTrigrams(trigrams(keyword));
+    if (keywordTrigrams.empty())
+        return false;
+
+    std::vector<const Postings*> lists;
+    lists.reserve(keywordTrigrams.size());
+    for (auto trigram : keywordTrigrams) {
+        auto it = m_postings.find(trigram);
+        if (it == m_postings.end())
+            // at least one trigram is missing: nothing can match
+            return true;
+        lists.push_back(&it->second);
+    }
+
+    // start from the shortest list to keep intersections small
+    std::sort(lists.begin(), lists.end(),
+            [](const Postings* a, const Postings* b) { return a->size() < b->size(); });
+    candidates = *lists.front();
+    std::vector<int> intersection;
+    for (auto it = lists.begin() + 1; it != lists.end() && !candidates.empty(); ++it) {
+        intersection.clear();
+        std::set_intersection(candidates.begin(), candidates.end(),
+                (*it)->begin(), (*it)->end(), std::back_inserter(intersection));
+        candidates.swap(intersection);
+    }
+    return true;
+}
+
+double HistoryMatchIndex::matchWeight(const Entry& entry,
+        const std::vector<std::string>& keywords)
+{
+    double weight = WEIGHT_URL;
+    for (const auto& keyword : keywords) {
+        const std::size_t pos = entry.url.find(keyword, entry.hostBegin);
+        if (pos == entry.hostBegin)
+            return WEIGHT_HOST_PREFIX;
+        if (pos < entry.hostEnd)
+            weight = WEIGHT_HOST;
+    }
+    return weight;
+}
+
+std::vector<int> HistoryMatchIndex::find(
+        const std::vector<std::string>& keywords, int maxItems,
+        bool uniqueUrls) const
+{
+    std::vector<int> result;
+    if (keywords.empty() || maxItems == 0)
+        return result;
+
+    const tools::KeywordMatcher matcher(keywords);
+    std::vector<const std::pair<const int, Entry>*> matches;
+    std::vector<int> candidates;
+    if (collectCandidates(keywords.front(), candidates)) {
+        matches.reserve(candidates.size());
+        for (auto id : candidates) {
+            auto it = m_entries.find(id);
+            if (it != m_entries.end() && matcher.matchesAll(it->second.url))
+                matches.push_back(&*it);
+        }
+    } else {
+        // keyword too short for trigrams, check every entry
+        for (const auto& entry : m_entries)
+            if (matcher.matchesAll(entry.second.url))
+                matches.push_back(&entry);
+    }
+
+    std::vector<int> frequencies;
+    if (uniqueUrls) {
+        // visits of the same url (differing only by scheme, "www." or
+        // trailing slash) are ranked together: frequencies are summed and the
+        // most recent visit represents the url
+        std::unordered_map<const Entry*, std::size_t, EntryKeyHash, EntryKeyEqual> firstByUrl;
+        firstByUrl.reserve(matches.size());
+        std::vector<const std::pair<const int, Entry>*> unique;
+        for (const auto match : matches) {
+            auto inserted = firstByUrl.emplace(&match->second, unique.size());
+            if (inserted.second) {
+                unique.push_back(match);
+                frequencies.push_back(match->second.frequency);
+                continue;
+            }
+            const std::size_t pos = inserted.first->second;
+            frequencies[pos] += match->second.frequency;
+            if (match->second.lastVisit > unique[pos]->second.lastVisit)
+                unique[pos] = match;
+        }
+        matches.swap(unique);
+    } else {
+        frequencies.reserve(matches.size());
+        for (const auto match : matches)
+            frequencies.push_back(match->second.frequency);
+    }
+
+    // keep only the best maxItems candidates in a min-heap
+    const std::size_t limit = maxItems < 0 ?
+            matches.size() : static_cast<std::size_t>(maxItems);
+    const std::time_t now = std::time(nullptr);
+    std::priority_queue<Candidate, std::vector<Candidate>,
+            bool (*)(const Candidate&, const Candidate&)> best(rankedBefore);
+    for (std::size_t i = 0; i < matches.size(); ++i) {
+        const Entry& entry = matches[i]->second;
+        Candidate candidate{matches[i]->first,
+                frecency(matchWeight(entry, keywords), frequencies[i],
+                        entry.lastVisit, now),
+                entry.lastVisit};
+        if (best.size() < limit) {
+            best.push(candidate);
+        } else if (rankedBefore(candidate, best.top())) {
+            best.pop();
+            best.push(candidate);
+        }
+    }
+
+    result.resize(best.size());
+    for (auto it = result.rbegin(); it != result.rend(); ++it) {
+        *it = best.top().id;
+        best.pop();
+    }
+    return result;
+}
+
+} /* namespace services */
+} /* namespace tizen_browser */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HISTORYMATCHINDEX_H_
+#define HISTORYMATCHINDEX_H_
+
+#include <ctime>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace tizen_browser {
+namespace services {
+
+/**
+ * @brief In-memory trigram index of history urls used by url autocompletion.
+ *
+ * Every history entry is stored with its lowercased url, last visit date and
+ * visit frequency. Each url is split into trigrams (three consecutive
+ * characters) and every trigram keeps a sorted list of ids of the entries
+ * containing it. Searching for a keyword intersects lists of its trigrams and
+ * verifies the remaining candidates with a plain substring check, so database
+ * is not touched at all.
+ *
+ * Matches are ranked by frecency: visit frequency weighted by recency of the
+ * last visit and by the place where keywords matched (beginning of the host,
+ * inside the host or anywhere else in the url).
+ *
+ * Index has to be kept in sync with the database by HistoryService.
+ */
+class HistoryMatchIndex
+{
+public:
+    HistoryMatchIndex();
+
+    /**
+     * @brief Adds entry to the index. If entry with given id already exists,
+     * it is replaced.
+     */
+    void insert(int id, const std::string& url, std::time_t lastVisit,
+            int frequency = 1);
+
+    /**
+     * @brief Updates last visit date of the entry and increments its visit
+     * frequency. Does nothing if entry is not indexed.
+     */
+    void visit(int id, std::time_t lastVisit);
+
+    /**
+     * @brief Sets visit frequency of the entry. Does nothing if entry
+     * is not indexed.
+     */
+    void setFrequency(int id, int frequency);
+
+    /**
+     * @brief Removes entry from the index.
+     */
+    void remove(int id);
+
+    /**
+     * @brief Removes all entries.
+     */
+    void clear();
+
+    std::size_t size() const { return m_entries.size(); }
+    bool empty() const { return m_entries.empty(); }
+
+    /**
+     * @brief Searches for entries, which urls contain all given keywords.
+     *
+     * @param keywords lowercased keywords, the first one is used to select
+     * candidates, so it should be the longest one
+     * @param maxItems results number will be shortened to this value,
+     * if -1: no shortening
+     * @param uniqueUrls true if returned ids should point to unique urls,
+     * visits of the same url are then ranked together and the most recent
+     * entry is returned. Urls differing only by scheme, "www." or trailing
+     * slash are the same url. Duplicates are removed before shortening,
+     * so maxItems unique urls are returned, if there are enough matches.
+     * @return ids of matching entries, the best ranked first
+     */
+    std::vector<int> find(const std::vector<std::string>& keywords,
+            int maxItems, bool uniqueUrls) const;
+
+private:
+    struct Entry
+    {
+        std::string url;
+        std::time_t lastVisit;
+        int frequency;
+        // host boundaries in url, without scheme and "www."
+        std::size_t hostBegin;
+        std::size_t hostEnd;
+        // end of the url without trailing slash, [hostBegin, keyEnd) is the
+        // key identifying duplicated urls
+        std::size_t keyEnd;
+    };
+    struct EntryKeyHash
+    {
+        std::size_t operator()(const Entry* entry) const;
+    };
+    struct EntryKeyEqual
+    {
+        bool operator()(const Entry* a, const Entry* b) const;
+    };
+    using Trigram = std::uint32_t;
+    using Postings = std::vector<int>;
+
+    static std::vector<Trigram> trigrams(const std::string& str);
+    void addPostings(int id, const std::string& url);
+    void removePostings(int id, const std::string& url);
+    bool collectCandidates(const std::string& keyword,
+            std::vector<int>& candidates) const;
+    static double matchWeight(const Entry& entry,
+            const std::vector<std::string>& keywords);
+
+    std::unordered_map<int, Entry> m_entries;
+    std::unordered_map<Trigram, Postings> m_postings;
+};
+
+} /* namespace services */
+} /* namespace tizen_browser */
+
+#endif /* HISTORYMATCHINDEX_H_ */
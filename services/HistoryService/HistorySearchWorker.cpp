@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <Ecore.h>
+#include "BrowserLogger.h"
+#include "HistorySearchWorker.h"
+
+namespace tizen_browser {
+namespace services {
+
+/**
+ * State shared with results queued in the main loop. They may outlive
+ * the worker, so it is kept alive by them.
+ */
+struct HistorySearchWorker::Shared
+{
+    explicit Shared(ResultCallback callback)
+        : generation(0)
+        , alive(true)
+        , callback(callback)
+    {
+    }
+    std::atomic<unsigned> generation;
+    // accessed from the main loop only
+    bool alive;
+    ResultCallback callback;
+};
+
+struct HistorySearchWorker::Result
+{
+    std::shared_ptr<Shared> shared;
+    unsigned generation;
+    std::string keywords;
+    std::shared_ptr<HistoryItemVector> items;
+};
+
+HistorySearchWorker::HistorySearchWorker(ResultCallback callback)
+    : m_shared(std::make_shared<Shared>(callback))
+    , m_pendingGeneration(0)
+    , m_quit(false)
+    , m_thread(&HistorySearchWorker::run, this)
+{
+}
+
+HistorySearchWorker::~HistorySearchWorker()
+{
+    m_shared->alive = false;
+    ++m_shared->generation;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+        m_pendingSearch = nullptr;
+    }
+    m_condition.notify_one();
+    m_thread.join();
+}
+
+void HistorySearchWorker::post(const std::string& keywords, Search search)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pendingGeneration = ++m_shared->generation;
+        m_pendingKeywords = keywords;
+        m_pendingSearch = search;
+    }
+    m_condition.notify_one();
+}
+
+void HistorySearchWorker::cancel()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_shared->generation;
+    m_pendingSearch = nullptr;
+}
+
+void HistorySearchWorker::run()
+{
+    for (;;) {
+        std::string keywords;
+        Search search;
+        unsigned generation;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_quit || m_pendingSearch; });
+            if (m_quit)
+                return;
+            keywords.swap(m_pendingKeywords);
+            search.swap(m_pendingSearch);
+            generation = m_pendingGeneration;
+        }
+
+        std::shared_ptr<Shared> shared(m_shared);
+        CancelCheck isCancelled = [shared, generation]() {
+            return shared->generation != generation;
+        };
+        std::shared_ptr<HistoryItemVector> items = search(isCancelled);
+        if (isCancelled()) {
+            BROWSER_LOGD("[%s:%d] search superseded: %s", __PRETTY_FUNCTION__, __LINE__, keywords.c_str());
+            continue;
+        }
+        ecore_main_loop_thread_safe_call_async(HistorySearchWorker::deliverResult,
+                new Result{shared, generation, keywords, items});
+    }
+}
+
+void HistorySearchWorker::deliverResult(void* data)
+{
+    std::unique_ptr<Result> result(static_cast<Result*>(data));
+    // results can be outdated, when user typed faster than main loop handled them
+    if (result->shared->alive && result->shared->generation == result->generation)
+        result->shared->callback(result->keywords, result->items);
+}
+
+} /* namespace services */
+} /* namespace tizen_browser */
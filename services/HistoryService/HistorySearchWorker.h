@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HISTORYSEARCHWORKER_H_
+#define HISTORYSEARCHWORKER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "HistoryItemTypedef.h"
+
+namespace tizen_browser {
+namespace services {
+
+/**
+ * @brief Runs history searches on a worker thread.
+ *
+ * Only the most recent search matters: posting a new one cancels the search
+ * which is still waiting or running, and results of superseded searches are
+ * never delivered. Results are passed to the callback from the main loop
+ * (ecore_main_loop_thread_safe_call_async), so callback can touch UI.
+ */
+class HistorySearchWorker
+{
+public:
+    /// returns true if the search is outdated and should be aborted
+    using CancelCheck = std::function<bool ()>;
+    using Search = std::function<std::shared_ptr<HistoryItemVector> (const CancelCheck&)>;
+    using ResultCallback = std::function<void (const std::string&,
+            std::shared_ptr<HistoryItemVector>)>;
+
+    explicit HistorySearchWorker(ResultCallback callback);
+    ~HistorySearchWorker();
+
+    /**
+     * @brief Schedules search, cancels the previous one.
+     *
+     * @param keywords keywords string, passed back to result callback
+     * @param search function executed on the worker thread
+     */
+    void post(const std::string& keywords, Search search);
+
+    /**
+     * @brief Cancels pending search, its results won't be delivered.
+     */
+    void cancel();
+
+private:
+    struct Shared;
+    struct Result;
+
+    void run();
+    static void deliverResult(void* data);
+
+    std::shared_ptr<Shared> m_shared;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::string m_pendingKeywords;
+    Search m_pendingSearch;
+    unsigned m_pendingGeneration;
+    bool m_quit;
+    std::thread m_thread;
+};
+
+} /* namespace services */
+} /* namespace tizen_browser */
+
+#endif /* HISTORYSEARCHWORKER_H_ */
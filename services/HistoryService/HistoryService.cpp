@@ -15,6 +15,9 @@
  */
 
 #include <string>
+#include <ctime>
+#include <algorithm>
+#include <unordered_set>
 #include <BrowserAssert.h>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/date.hpp>
@@ -27,9 +30,10 @@
 #include "AbstractWebEngine.h"
 
 #include "EflTools.h"
+#include "FaviconStorage.h"
 
 #include "Tools/GeneralTools.h"
-#include "Tools/StringTools.h"
+#include "Tools/LatencyTracer.h"
 #include "HistoryServiceTools.h"
 #include "Tools/CapiWebErrorCodes.h"
 
@@ -41,14 +45,51 @@ namespace services
 EXPORT_SERVICE(HistoryService, DOMAIN_HISTORY_SERVICE)
 
 const int SEARCH_LIKE = 1;
+// updates of the loaded page (visit, favicon, snapshot) come within it
+const std::chrono::milliseconds JOURNAL_DELAY(500);
 
-HistoryService::HistoryService() : m_testDbMod(false)
+namespace
+{
+// history keeps one item of the url per day, its visits are counted there
+std::time_t startOfToday()
+{
+    std::time_t now = std::time(nullptr);
+    std::tm today;
+    localtime_r(&now, &today);
+    today.tm_hour = 0;
+    today.tm_min = 0;
+    today.tm_sec = 0;
+    return std::mktime(&today);
+}
+}
+
+HistoryService::HistoryService()
+    : m_testDbMod(false)
+    , m_indexState(IndexState::BUILDING)
+    , m_stopIndexing(false)
+    , m_journal(new HistoryJournal(
+        [this](const std::vector<HistoryJournal::Entry>& entries) { writeHistoryEntries(entries); },
+        JOURNAL_DELAY))
 {
     BROWSER_LOGD("HistoryService");
+    // reading every history item takes long for long history, service
+    // is created on the main loop
+    m_indexBuilder = std::thread(&HistoryService::buildMatchIndex, this);
 }
 
 HistoryService::~HistoryService()
 {
+    // search in progress may flush the journal, which is written last
+    m_searchWorker.reset();
+    m_stopIndexing = true;
+    m_indexBuilder.join();
+    m_journal.reset();
+}
+
+void HistoryService::flush()
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    m_journal->flush();
 }
 
 void HistoryService::setStorageServiceTestMode(bool testmode) {
@@ -64,6 +105,7 @@ void HistoryService::errorPrint(std::string method) const
 }
 
 int HistoryService::getHistoryItemsCount(){
+    m_journal->flush();
     int *ids = nullptr;
     int count=0;
     bp_history_rows_cond_fmt conds;
@@ -82,44 +124,110 @@ int HistoryService::getHistoryItemsCount(){
     return count;
 }
 
-bool HistoryService::isDuplicate(const char* url) const
+void HistoryService::buildMatchIndex()
 {
-    M_ASSERT(url);
-    int *ids=nullptr;
-    int count=0;
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    // database is read without the lock, so searches are not blocked
+    HistoryMatchIndex matchIndex;
+    HistoryUrlIndex urlIndex;
+
+    int *ids = nullptr;
+    int count = 0;
     bp_history_rows_cond_fmt conds;
     conds.limit = -1;  //no of rows to get negative means no limitation
     conds.offset = -1;   //the first row's index
-    conds.order_offset =BP_HISTORY_O_DATE_CREATED; // property to sort
+    conds.order_offset = BP_HISTORY_O_DATE_VISITED; // property to sort
     conds.ordering = 1; //way of ordering 0 asc 1 desc
-    conds.period_offset = BP_HISTORY_O_DATE_CREATED;
-    conds.period_type = BP_HISTORY_DATE_TODAY;
-    if(bp_history_adaptor_get_cond_ids_p(&ids ,&count, &conds, 0, nullptr, 0) < 0 ) {
+    conds.period_offset = BP_HISTORY_O_DATE_VISITED;
+    conds.period_type = BP_HISTORY_DATE_ALL;
+    if (bp_history_adaptor_get_cond_ids_p(&ids, &count, &conds, 0, nullptr, 0) < 0) {
         errorPrint("bp_history_adaptor_get_cond_ids_p");
+        std::lock_guard<std::mutex> lock(m_matchIndexMutex);
+        m_indexState = IndexState::UNAVAILABLE;
+        m_pendingIndexUpdates.clear();
+        return;
     }
 
-    bp_history_offset offset = (BP_HISTORY_O_URL | BP_HISTORY_O_DATE_CREATED);
-
-    for (int i = 0; i < count; i++) {
+    bp_history_offset offset = (BP_HISTORY_O_URL | BP_HISTORY_O_DATE_CREATED | BP_HISTORY_O_DATE_VISITED
+            | BP_HISTORY_O_FREQUENCY);
+    for (int i = 0; i < count && !m_stopIndexing; i++) {
         bp_history_info_fmt history_info;
         if (bp_history_adaptor_get_info(ids[i], offset, &history_info) < 0) {
-            BROWSER_LOGE("[%s:%d] bp_history_adaptor_get_info error ",
-                    __PRETTY_FUNCTION__, __LINE__);
-            return false;
+            errorPrint("bp_history_adaptor_get_info");
+            continue;
         }
-        if (!history_info.url) {
-            BROWSER_LOGD("Warning: history entry without url!");
-        } else if (!strcmp(history_info.url, url)) {
-            int freq;
-            bp_history_adaptor_get_frequency(ids[i], &freq);
-            bp_history_adaptor_set_frequency(ids[i], freq + 1);
-            bp_history_adaptor_set_date_visited(ids[i],-1);
-            bp_history_adaptor_easy_free(&history_info);
-            return true;
+        if (history_info.url) {
+            matchIndex.insert(ids[i], history_info.url, history_info.date_visited,
+                    history_info.frequency);
+            urlIndex.insert(ids[i], history_info.url, history_info.date_created);
         }
         bp_history_adaptor_easy_free(&history_info);
     }
-    return false;
+    free(ids);
+    if (m_stopIndexing)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_matchIndexMutex);
+    m_matchIndex = std::move(matchIndex);
+    m_urlIndex = std::move(urlIndex);
+    // items already read with the update get it twice: inserts, removals
+    // and frequency changes do not mind, a visit is counted twice
+    for (const auto& update : m_pendingIndexUpdates)
+        update();
+    m_pendingIndexUpdates.clear();
+    m_indexState = IndexState::READY;
+    BROWSER_LOGD("[%s:%d] indexed %zu history items", __PRETTY_FUNCTION__, __LINE__, m_matchIndex.size());
+}
+
+void HistoryService::updateIndexes(std::function<void ()> update)
+{
+    std::lock_guard<std::mutex> lock(m_matchIndexMutex);
+    switch (m_indexState) {
+    case IndexState::READY:
+        update();
+        break;
+    case IndexState::BUILDING:
+        m_pendingIndexUpdates.push_back(std::move(update));
+        break;
+    case IndexState::UNAVAILABLE:
+        break;
+    }
+}
+
+bool HistoryService::isIndexReady()
+{
+    std::lock_guard<std::mutex> lock(m_matchIndexMutex);
+    return m_indexState == IndexState::READY;
+}
+
+int HistoryService::visitDuplicate(const std::string& url, int visits)
+{
+    int id = 0;
+    bool indexed = false;
+    {
+        std::lock_guard<std::mutex> lock(m_matchIndexMutex);
+        indexed = m_indexState == IndexState::READY;
+        if (indexed)
+            id = m_urlIndex.find(url, startOfToday());
+    }
+    if (!indexed)
+        id = queryHistoryId(url, BP_HISTORY_DATE_TODAY);
+    if (id == 0)
+        return 0;
+
+    int freq = 0;
+    if (bp_history_adaptor_get_frequency(id, &freq) < 0)
+        errorPrint("bp_history_adaptor_get_frequency");
+    if (bp_history_adaptor_set_frequency(id, freq + visits) < 0)
+        errorPrint("bp_history_adaptor_set_frequency");
+    if (bp_history_adaptor_set_date_visited(id, -1) < 0)
+        errorPrint("bp_history_adaptor_set_date_visited");
+    const std::time_t now = std::time(nullptr);
+    updateIndexes([this, id, visits, now]() {
+        for (int visit = 0; visit < visits; ++visit)
+            m_matchIndex.visit(id, now);
+    });
+    return id;
 }
 
 std::shared_ptr<HistoryItemVector> HistoryService::getHistoryAll()
@@ -155,6 +263,7 @@ std::shared_ptr<HistoryItemVector> HistoryService::getHistoryOlder()
 int HistoryService::getHistoryCnt(const int& id)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    m_journal->flush();
     int freq, retVal = 0;
 
     if (!bp_history_adaptor_get_frequency(id, &freq))
@@ -165,6 +274,7 @@ int HistoryService::getHistoryCnt(const int& id)
 
 std::shared_ptr<HistoryItemVector> HistoryService::getMostVisitedHistoryItems()
 {
+    m_journal->flush();
     std::shared_ptr<HistoryItemVector> ret_history_list(new HistoryItemVector);
 
     int *ids=nullptr;
@@ -256,6 +366,7 @@ std::shared_ptr<HistoryItemVector> HistoryService::getMostVisitedHistoryItems()
 void HistoryService::cleanMostVisitedHistoryItems()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    m_journal->flush();
 
     int *ids=nullptr;
     int count=-1;
@@ -275,12 +386,19 @@ void HistoryService::cleanMostVisitedHistoryItems()
     for(int i = 0; i < count; i++){
             bp_history_adaptor_set_frequency(ids[i], 0);
     }
+    std::vector<int> cleaned(ids, ids + count);
+    free(ids);
+    updateIndexes([this, cleaned]() {
+        for (auto id : cleaned)
+            m_matchIndex.setFrequency(id, 0);
+    });
     BROWSER_LOGD("Deleted Most Visited Sites!");
 }
 
 std::shared_ptr<HistoryItemVector> HistoryService::getHistoryItemsByKeyword(
         const std::string & keyword, int maxItems)
 {
+    m_journal->flush();
     std::string search("%" + keyword + "%");    // add SQL 'any character' signs
 
     std::shared_ptr<HistoryItemVector> items(new HistoryItemVector);
@@ -334,12 +452,52 @@ void HistoryService::addHistoryItem(const std::string & url,
         return;
     }
 
-    if (isDuplicate(url.c_str()))
-        return;
+    m_journal->visit(url, title, favicon);
+}
+
+void HistoryService::updateHistoryItemFavicon(const std::string & url, tools::BrowserImagePtr favicon)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    if (favicon)
+        m_journal->setFavicon(url, favicon);
+}
+
+void HistoryService::updateHistoryItemSnapshot(const std::string & url, tools::BrowserImagePtr snapshot)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    if (snapshot)
+        m_journal->setSnapshot(url, snapshot);
+}
+
+void HistoryService::writeHistoryEntries(const std::vector<HistoryJournal::Entry>& entries)
+{
+    for (const auto& entry : entries) {
+        // favicons belong to hosts, they do not need the history item
+        if (entry.favicon)
+            writeHistoryFavicon(entry.url, entry.favicon);
+        int id = 0;
+        if (entry.visits > 0)
+            id = writeHistoryVisit(entry.url, entry.title, entry.visits);
+        else
+            id = findHistoryId(entry.url);
+        if (id == 0) {
+            BROWSER_LOGW("Cannot update history item, there is no such history item!");
+            continue;
+        }
+        if (entry.snapshot)
+            writeHistorySnapshot(id, entry.snapshot);
+    }
+}
+
+int HistoryService::writeHistoryVisit(const std::string & url, const std::string & title, int visits)
+{
+    int id = visitDuplicate(url, visits);
+    if (id != 0)
+        return id;
 
-    int id = -1;
     if(bp_history_adaptor_create(&id) < 0) {
         errorPrint("bp_history_adaptor_create");
+        return 0;
     }
     if (bp_history_adaptor_set_url(id, url.c_str()) < 0) {
         errorPrint("bp_history_adaptor_set_url");
@@ -350,114 +508,124 @@ void HistoryService::addHistoryItem(const std::string & url,
     if (bp_history_adaptor_set_date_visited(id,-1) < 0) {
         errorPrint("bp_history_adaptor_set_date_visited");
     }
-    if (bp_history_adaptor_set_frequency(id, 1) < 0) {
+    if (bp_history_adaptor_set_frequency(id, visits) < 0) {
         errorPrint("bp_history_adaptor_set_frequency");
     }
-
-    if (favicon) {
-       std::unique_ptr<tools::Blob> favicon_blob = tools::EflTools::getBlobPNG(favicon);
-       if (!favicon_blob){
-           BROWSER_LOGW("getBlobPNG failed");
-           return;
-       }
-       unsigned char * fav = std::move((unsigned char*)favicon_blob->getData());
-       if (bp_history_adaptor_set_icon(id, favicon->getWidth(), favicon->getHeight(), fav, favicon_blob->getLength()) < 0) {
-           errorPrint("bp_history_adaptor_set_icon");
-        }
-    }
+    const std::time_t now = std::time(nullptr);
+    updateIndexes([this, id, url, now, visits]() {
+        m_matchIndex.insert(id, url, now, visits);
+        m_urlIndex.insert(id, url, now);
+    });
+    return id;
 }
 
-void HistoryService::updateHistoryItemFavicon(const std::string & url, tools::BrowserImagePtr favicon)
+void HistoryService::writeHistoryFavicon(const std::string & url, tools::BrowserImagePtr favicon)
 {
-    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    int id = getHistoryId(url);
-    if (id!=0) {
-        if (favicon) {
-           std::unique_ptr<tools::Blob> favicon_blob = tools::EflTools::getBlobPNG(favicon);
-           if (!favicon_blob){
-               BROWSER_LOGW("getBlobPNG failed");
-               return;
-           }
-           unsigned char * fav = std::move((unsigned char*)favicon_blob->getData());
-           if (bp_history_adaptor_set_icon(id, favicon->getWidth(), favicon->getHeight(), fav, favicon_blob->getLength()) < 0) {
-               errorPrint("bp_history_adaptor_set_icon");
-            }
-        }
-    } else {
-        BROWSER_LOGW("Cannot update favicon, there is no such history item!");
-    }
+    storage::FaviconStorage::getInstance().setFavicon(url, favicon);
 }
 
-void HistoryService::updateHistoryItemSnapshot(const std::string & url, tools::BrowserImagePtr snapshot)
+void HistoryService::writeHistorySnapshot(int id, tools::BrowserImagePtr snapshot)
 {
-    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    int id = getHistoryId(url);
-    if (id != 0 && snapshot) {
-        std::unique_ptr<tools::Blob> snapshot_blob = tools::EflTools::getBlobPNG(snapshot);
-        if (!snapshot_blob){
-            BROWSER_LOGW("getBlobPNG failed");
-            return;
-        }
-        unsigned char * snap = std::move((unsigned char*)snapshot_blob->getData());
-        if (bp_history_adaptor_set_snapshot(id, snapshot->getWidth(), snapshot->getHeight(), snap,
-                snapshot_blob->getLength()) < 0)
-            errorPrint("bp_history_adaptor_set_snapshot");
+    std::unique_ptr<tools::Blob> snapshot_blob = tools::EflTools::getBlob(snapshot);
+    if (!snapshot_blob){
+        BROWSER_LOGW("getBlob failed");
+        return;
     }
+    unsigned char * snap = std::move((unsigned char*)snapshot_blob->getData());
+    if (bp_history_adaptor_set_snapshot(id, snapshot->getWidth(), snapshot->getHeight(), snap,
+            snapshot_blob->getLength()) < 0)
+        errorPrint("bp_history_adaptor_set_snapshot");
 }
 
 void HistoryService::clearAllHistory()
 {
+    // pending visits would be written to the cleared history
+    m_journal->discard();
     bp_history_adaptor_reset();
     history_list.clear();
+    storage::FaviconStorage::getInstance().clear();
+    updateIndexes([this]() {
+        m_matchIndex.clear();
+        m_urlIndex.clear();
+    });
     historyAllDeleted();
 }
 
 int HistoryService::getHistoryId(const std::string & url)
+{
+    m_journal->flush();
+    return findHistoryId(url);
+}
+
+int HistoryService::findHistoryId(const std::string & url)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_matchIndexMutex);
+        if (m_indexState == IndexState::READY)
+            return m_urlIndex.find(url);
+    }
+    return queryHistoryId(url, BP_HISTORY_DATE_ALL);
+}
+
+int HistoryService::queryHistoryId(const std::string & url, bp_history_date_defs period)
 {
     bp_history_rows_cond_fmt conds;
-    conds.limit = -1;
+    conds.limit = 1;
     conds.offset = 0;
     conds.order_offset = BP_HISTORY_O_DATE_CREATED;
-    conds.ordering = 0;
+    conds.ordering = 1; //way of ordering 0 asc 1 desc
     conds.period_offset = BP_HISTORY_O_DATE_CREATED;
-    conds.period_type = BP_HISTORY_DATE_ALL;
+    conds.period_type = period;
     int *ids = nullptr;
     int ids_count = 0;
-    if(bp_history_adaptor_get_cond_ids_p(&ids ,&ids_count, &conds, BP_HISTORY_O_URL, url.c_str(), 0) < 0) {
+    if (bp_history_adaptor_get_cond_ids_p(&ids, &ids_count, &conds, BP_HISTORY_O_URL, url.c_str(), 0) < 0) {
         errorPrint("bp_history_adaptor_get_cond_ids_p");
-    } else if (ids_count != 0) {
-        int i = *ids;
-        free(ids);
-        return i;
+        return 0;
     }
-    return 0;
+    int id = ids_count > 0 ? ids[0] : 0;
+    free(ids);
+    return id;
 }
 
 void HistoryService::clearURLHistory(const std::string & url)
 {
     int id = getHistoryId(url);
-    if (id!=0)
+    if (id!=0) {
         bp_history_adaptor_delete(id);
+        updateIndexes([this, id]() {
+            m_matchIndex.remove(id);
+            m_urlIndex.remove(id);
+        });
+    }
     if(0 == getHistoryItemsCount())
         historyEmpty(true);
     historyDeleted(url);
 }
 
 void HistoryService::deleteHistoryItem(int id) {
+    m_journal->flush();
     if (bp_history_adaptor_delete(id) < 0) {
         errorPrint("bp_history_adaptor_delete");
     }
+    updateIndexes([this, id]() {
+        m_matchIndex.remove(id);
+        m_urlIndex.remove(id);
+    });
 }
 
 void HistoryService::setMostVisitedFrequency(int id, int frequency)
 {
+    m_journal->flush();
     if (bp_history_adaptor_set_frequency(id, frequency) < 0 )
         errorPrint("bp_history_adaptor_set_frequency");
+    updateIndexes([this, id, frequency]() {
+        m_matchIndex.setFrequency(id, frequency);
+    });
 }
 
 std::shared_ptr<HistoryItem> HistoryService::getHistoryItem(int * ids, int idNumber)
 {
-    bp_history_offset offset = (BP_HISTORY_O_URL | BP_HISTORY_O_TITLE | BP_HISTORY_O_FAVICON | BP_HISTORY_O_DATE_VISITED);
+    bp_history_offset offset = (BP_HISTORY_O_URL | BP_HISTORY_O_TITLE | BP_HISTORY_O_DATE_CREATED);
     bp_history_info_fmt history_info;
     if (bp_history_adaptor_get_info(ids[idNumber], offset, &history_info) < 0) {
         BROWSER_LOGE("[%s:%d] bp_history_adaptor_get_info error ",
@@ -467,16 +635,15 @@ std::shared_ptr<HistoryItem> HistoryService::getHistoryItem(int * ids, int idNum
 
     if (!history_info.url) {
         BROWSER_LOGW("[%s:%d] history_info.url is empty! Wrong DB entry found! ", __PRETTY_FUNCTION__, __LINE__);
+        bp_history_adaptor_easy_free(&history_info);
         return std::shared_ptr<HistoryItem>();
     }
 
-    int date;
-    bp_history_adaptor_get_date_created(ids[idNumber], &date);
-
-    time_t item_time = (time_t) date;
+    time_t item_time = (time_t) history_info.date_created;
     struct tm item_time_info;
     if (gmtime_r(&item_time,&item_time_info) == NULL) {
         BROWSER_LOGE("[%s:%d] History localtime_r error ", __PRETTY_FUNCTION__, __LINE__);
+        bp_history_adaptor_easy_free(&history_info);
         return std::shared_ptr<HistoryItem>();
     }
 
@@ -496,33 +663,95 @@ std::shared_ptr<HistoryItem> HistoryService::getHistoryItem(int * ids, int idNum
     history->setUrl(std::string(history_info.url ? history_info.url : ""));
     history->setTitle(std::string(history_info.title ? history_info.title : ""));
 
-    auto thumbnail = std::make_shared<tools::BrowserImage>(
-        history_info.thumbnail_width,
-        history_info.thumbnail_height,
-        history_info.thumbnail_length);
-    thumbnail->setData((void*)history_info.thumbnail, false, tools::ImageType::ImageTypePNG);
+    const int id = ids[idNumber];
+    const std::string url(history->getUrl());
+    history->setThumbnailLoader([this, id]() { return loadThumbnail(id); });
+    history->setFavIconLoader([this, id, url]() { return loadFavIcon(id, url); });
+
+    bp_history_adaptor_easy_free(&history_info);
+
+    return history;
+}
+
+tools::BrowserImagePtr HistoryService::loadFavIcon(int id, const std::string& url)
+{
+    auto stored = storage::FaviconStorage::getInstance().getFavicon(url);
+    if (stored)
+        return stored;
+
+    // items written before the favicon store keep their favicons in history
+    bp_history_info_fmt history_info;
+    if (bp_history_adaptor_get_info(id, BP_HISTORY_O_FAVICON, &history_info) < 0) {
+        errorPrint("bp_history_adaptor_get_info");
+        return std::make_shared<tools::BrowserImage>();
+    }
     auto favIcon = std::make_shared<tools::BrowserImage>(
         history_info.favicon_width,
         history_info.favicon_height,
         history_info.favicon_length);
     favIcon->setData((void*)history_info.favicon, false, tools::ImageType::ImageTypePNG);
-    history->setThumbnail(thumbnail);
-    history->setFavIcon(favIcon);
+    bp_history_adaptor_easy_free(&history_info);
+
+    // moved to the store, so other items of the host share it
+    if (favIcon->getSize() > 0)
+        storage::FaviconStorage::getInstance().setFavicon(url, favIcon);
+    return favIcon;
+}
 
+tools::BrowserImagePtr HistoryService::loadThumbnail(int id)
+{
+    bp_history_info_fmt history_info;
+    if (bp_history_adaptor_get_info(id, BP_HISTORY_O_THUMBNAIL, &history_info) < 0) {
+        errorPrint("bp_history_adaptor_get_info");
+        return std::make_shared<tools::BrowserImage>();
+    }
+    auto thumbnail = std::make_shared<tools::BrowserImage>(
+        history_info.thumbnail_width,
+        history_info.thumbnail_height,
+        history_info.thumbnail_length);
+    thumbnail->setData((void*)history_info.thumbnail, false, tools::ImageType::ImageTypePNG);
     bp_history_adaptor_easy_free(&history_info);
+    return thumbnail;
+}
 
+std::shared_ptr<HistoryItem> HistoryService::getMatchedHistoryItem(int id)
+{
+    bp_history_offset offset = (BP_HISTORY_O_URL | BP_HISTORY_O_TITLE);
+    bp_history_info_fmt history_info;
+    if (bp_history_adaptor_get_info(id, offset, &history_info) < 0) {
+        BROWSER_LOGE("[%s:%d] bp_history_adaptor_get_info error ",
+                __PRETTY_FUNCTION__, __LINE__);
+        return std::shared_ptr<HistoryItem>();
+    }
+
+    std::shared_ptr<HistoryItem> history;
+    if (!history_info.url) {
+        BROWSER_LOGW("[%s:%d] history_info.url is empty! Wrong DB entry found! ", __PRETTY_FUNCTION__, __LINE__);
+    } else {
+        history = std::make_shared<HistoryItem>(id, std::string(history_info.url));
+        history->setTitle(std::string(history_info.title ? history_info.title : ""));
+    }
+    bp_history_adaptor_easy_free(&history_info);
     return history;
 }
 
 std::shared_ptr<HistoryItemVector> HistoryService::getHistoryItems(bp_history_date_defs period)
 {
+    return getHistoryPage(period, 0, -1);
+}
+
+std::shared_ptr<HistoryItemVector> HistoryService::getHistoryPage(
+        bp_history_date_defs period, int offset, int limit)
+{
+    BROWSER_LOGD("[%s:%d] offset: %d, limit: %d", __PRETTY_FUNCTION__, __LINE__, offset, limit);
+    m_journal->flush();
     std::shared_ptr<HistoryItemVector> ret_history_list(new HistoryItemVector);
 
     int *ids=nullptr;
     int count=-1;
     bp_history_rows_cond_fmt conds;
-    conds.limit = -1;  //no of rows to get negative means no limitation
-    conds.offset = -1;   //the first row's index
+    conds.limit = limit;  //no of rows to get negative means no limitation
+    conds.offset = offset;   //the first row's index
     conds.order_offset = BP_HISTORY_O_DATE_VISITED; // property to sort
     conds.ordering = 1; //way of ordering 0 asc 1 desc
     conds.period_offset = BP_HISTORY_O_DATE_VISITED;
@@ -532,6 +761,9 @@ std::shared_ptr<HistoryItemVector> HistoryService::getHistoryItems(bp_history_da
         errorPrint("bp_history_adaptor_get_cond_ids_p");
     }
 
+    // adaptor can't return rows, only ids, so info is still read per id,
+    // but only for the ids of the requested page
+    ret_history_list->reserve(std::max(count, 0));
     for(int i = 0; i< count; i++) {
         std::shared_ptr<HistoryItem> item = getHistoryItem(ids, i);
         if (!item)
@@ -553,45 +785,97 @@ std::shared_ptr<HistoryItemVector> HistoryService::getHistoryItemsByKeywordsStri
         const std::string& keywordsString, const int maxItems,
         const unsigned int minKeywordLength, bool uniqueUrls)
 {
-    if (keywordsString.empty())
-        return std::make_shared<HistoryItemVector>();
+    return findHistoryItemsByKeywordsString(keywordsString, maxItems,
+            minKeywordLength, uniqueUrls, []() { return false; });
+}
 
-    std::vector<std::string> keywords;
-    tools::string_tools::splitString(keywordsString, keywords);
+void HistoryService::searchHistoryItemsByKeywordsString(
+        const std::string& keywordsString, const int maxItems,
+        const unsigned int minKeywordLength, bool uniqueUrls)
+{
+    if (!m_searchWorker)
+        m_searchWorker.reset(new HistorySearchWorker(
+            [this](const std::string& keywords, std::shared_ptr<HistoryItemVector> items) {
+                historyItemsByKeywordsFound(keywords, items);
+            }));
+    m_searchWorker->post(keywordsString,
+        [this, keywordsString, maxItems, minKeywordLength, uniqueUrls](
+                const HistorySearchWorker::CancelCheck& isCancelled) {
+            return findHistoryItemsByKeywordsString(keywordsString, maxItems,
+                    minKeywordLength, uniqueUrls, isCancelled);
+        });
+}
+
+void HistoryService::cancelHistoryItemsSearch()
+{
+    if (m_searchWorker)
+        m_searchWorker->cancel();
+}
 
-    // the longer the keyword is, the faster search will be
-    const unsigned longestKeywordPos = tools::string_tools::getLongest(keywords);
-    std::string longestKeyword = keywords.at(longestKeywordPos);
-    boost::algorithm::to_lower(longestKeyword);
+std::shared_ptr<HistoryItemVector> HistoryService::findHistoryItemsByKeywordsString(
+        const std::string& keywordsString, const int maxItems,
+        const unsigned int minKeywordLength, bool uniqueUrls,
+        const HistorySearchWorker::CancelCheck& isCancelled)
+{
+    tools::ScopedLatency latency(tools::autocomplete_stage::HISTORY_SEARCH);
 
     // assumption: search starts when longest keyword is at least
     // minKeywordLength characters long
-    if (longestKeyword.length() < minKeywordLength) {
+    std::vector<std::string> keywords;
+    if (!prepareSearchKeywords(keywordsString, minKeywordLength, keywords))
         return std::make_shared<HistoryItemVector>();
-    }
 
-    // get all results for the longest keyword
-    std::shared_ptr<HistoryItemVector> historyItems = getHistoryItemsByKeyword(
-            longestKeyword, -1);
+    auto historyItems = std::make_shared<HistoryItemVector>();
+    if (maxItems == 0)
+        return historyItems;
 
-    if (keywords.size() > 1) {
-        // longestKeywordPos is already handled
-        keywords.erase(keywords.begin() + longestKeywordPos);
-        tools::string_tools::downcase(keywords);
-        removeMismatches(historyItems, keywords);
-    }
+    if (!isIndexReady())
+        return queryHistoryItemsByKeywords(keywords, maxItems, uniqueUrls);
 
-    if (maxItems != -1) {
-        if (historyItems->size() > static_cast<unsigned int>(maxItems)) {
-            historyItems->erase(historyItems->begin() + maxItems,
-                    historyItems->end());
+    // only the matches which will be shown are read from the database,
+    // if some of them cannot be read, more candidates are requested
+    std::unordered_set<int> readIds;
+    int limit = maxItems;
+    for (;;) {
+        std::vector<int> ids;
+        {
+            tools::ScopedLatency findLatency(tools::autocomplete_stage::MATCH_INDEX_FIND);
+            std::lock_guard<std::mutex> lock(m_matchIndexMutex);
+            ids = m_matchIndex.find(keywords, limit, uniqueUrls);
+        }
+        for (auto id : ids) {
+            if (isCancelled())
+                return historyItems;
+            if (!readIds.insert(id).second)
+                continue;
+            std::shared_ptr<HistoryItem> item = getMatchedHistoryItem(id);
+            if (item)
+                historyItems->push_back(item);
+            if (maxItems > 0 && static_cast<int>(historyItems->size()) == maxItems)
+                return historyItems;
         }
+        // no more matches
+        if (maxItems < 0 || static_cast<int>(ids.size()) < limit)
+            return historyItems;
+        limit *= 2;
     }
+}
+
 
+std::shared_ptr<HistoryItemVector> HistoryService::queryHistoryItemsByKeywords(
+        std::vector<std::string> keywords, const int maxItems, bool uniqueUrls)
+{
+    // the first keyword is the longest one, the fewest items match it
+    std::shared_ptr<HistoryItemVector> historyItems =
+            getHistoryItemsByKeyword(keywords.front(), -1);
+    keywords.erase(keywords.begin());
+    if (!keywords.empty())
+        removeMismatches(historyItems, keywords);
     if (uniqueUrls)
         removeUrlDuplicates(historyItems);
+    if (maxItems > 0 && historyItems->size() > static_cast<unsigned>(maxItems))
+        historyItems->erase(historyItems->begin() + maxItems, historyItems->end());
     return historyItems;
 }
-
 }
 }
@@ -17,8 +17,12 @@
 #ifndef __HISTORY_SERVICE_H
 #define __HISTORY_SERVICE_H
 
+#include <atomic>
+#include <functional>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <boost/date_time/gregorian/gregorian.hpp>
 #include <boost/signals2/signal.hpp>
 
@@ -26,6 +30,10 @@
 #include "service_macros.h"
 #include "BrowserImage.h"
 #include "HistoryItemTypedef.h"
+#include "HistoryJournal.h"
+#include "HistoryMatchIndex.h"
+#include "HistorySearchWorker.h"
+#include "HistoryUrlIndex.h"
 #include "StorageService.h"
 #include <web/web_history.h>
 #define DOMAIN_HISTORY_SERVICE "org.tizen.browser.historyservice"
@@ -50,6 +58,12 @@ public:
                                   tools::BrowserImagePtr favicon);
     void updateHistoryItemSnapshot(const std::string & url,
                                    tools::BrowserImagePtr snapshot);
+
+    /**
+     * @brief Writes history updates, which are still in the journal.
+     * Called, when the application is paused or terminated.
+     */
+    void flush();
     void clearAllHistory();
     void clearURLHistory(const std::string & url);
     void deleteHistoryItem(int id);
@@ -61,6 +75,20 @@ public:
     std::shared_ptr<HistoryItemVector> getHistoryLastWeek();
     std::shared_ptr<HistoryItemVector> getHistoryLastMonth();
     std::shared_ptr<HistoryItemVector> getHistoryOlder();
+
+    /**
+     * @brief Returns one page of history items visited in given period.
+     *
+     * Items are sorted by visit date, the most recent first. Only metadata is
+     * read, favicons and thumbnails are loaded when requested.
+     *
+     * @param period period of visit date
+     * @param offset index of the first item of the page
+     * @param limit maximum number of items, if -1: no limitation
+     * @return vector of history items, shorter than limit for the last page
+     */
+    std::shared_ptr<HistoryItemVector> getHistoryPage(
+            bp_history_date_defs period, int offset, int limit);
     std::shared_ptr<HistoryItemVector> getMostVisitedHistoryItems();
     void cleanMostVisitedHistoryItems();
     std::shared_ptr<HistoryItemVector> getHistoryItemsByKeyword(const std::string & keyword, int maxItems);
@@ -89,17 +117,56 @@ public:
             const std::string& keywordsString, const int maxItems,
             const unsigned int minKeywordLength, bool uniqueUrls = false);
 
+    /**
+     * @brief Asynchronous version of getHistoryItemsByKeywordsString.
+     *
+     * Search is done on a worker thread. Each call cancels the search still
+     * in progress. Results are sent with historyItemsByKeywordsFound signal
+     * from the main loop, results of cancelled searches are never sent.
+     */
+    void searchHistoryItemsByKeywordsString(
+            const std::string& keywordsString, const int maxItems,
+            const unsigned int minKeywordLength, bool uniqueUrls = false);
+
+    /**
+     * @brief Cancels search started by searchHistoryItemsByKeywordsString.
+     */
+    void cancelHistoryItemsSearch();
+
+    /**
+     * @brief Returns true, when url indexes are built. Until then, searches
+     * query the database.
+     */
+    bool isIndexReady();
+
     int getHistoryItemsCount();
     void setStorageServiceTestMode(bool testmode = true);
 
     boost::signals2::signal<void (bool)>historyEmpty;
     boost::signals2::signal<void (const std::string& uri)> historyDeleted;
     boost::signals2::signal<void ()> historyAllDeleted;
+    boost::signals2::signal<void (const std::string&, std::shared_ptr<HistoryItemVector>)>
+        historyItemsByKeywordsFound;
 
 private:
     bool m_testDbMod;;
     std::vector<std::shared_ptr<HistoryItem>> history_list;
     std::shared_ptr<tizen_browser::services::StorageService> m_storageManager;
+    enum class IndexState { BUILDING, READY, UNAVAILABLE };
+
+    HistoryMatchIndex m_matchIndex;
+    HistoryUrlIndex m_urlIndex;
+    // indexes are read by the search worker and updated by the journal worker
+    std::mutex m_matchIndexMutex;
+    // until indexes are built, the database is queried instead
+    IndexState m_indexState;
+    // updates made while indexes are built, replayed on the built indexes
+    std::vector<std::function<void ()>> m_pendingIndexUpdates;
+    std::atomic<bool> m_stopIndexing;
+    std::thread m_indexBuilder;
+    std::unique_ptr<HistorySearchWorker> m_searchWorker;
+    // visits and images of loaded pages, written on its worker thread
+    std::unique_ptr<HistoryJournal> m_journal;
 
     /**
      * Help method printing last bp_history_error_defs error.
@@ -111,9 +178,66 @@ private:
      */
     void initDatabaseBookmark(const std::string & db_str);
 
+    /**
+     * @brief Fills url matching index and url index with all history entries.
+     * Runs on m_indexBuilder thread, indexes are published when complete.
+     */
+    void buildMatchIndex();
+
+    /**
+     * @brief Applies update to the indexes, or keeps it for the indexes being
+     * built. Called with the database already updated.
+     */
+    void updateIndexes(std::function<void ()> update);
+
+    /**
+     * @brief Creates history item with metadata only. Favicon and thumbnail
+     * are read from the database, when they are requested for the first time.
+     */
     std::shared_ptr<HistoryItem> getHistoryItem(int* ids, int idNumber = 0);
+    tools::BrowserImagePtr loadFavIcon(int id, const std::string& url);
+    tools::BrowserImagePtr loadThumbnail(int id);
+    std::shared_ptr<HistoryItem> getMatchedHistoryItem(int id);
+    std::shared_ptr<HistoryItemVector> findHistoryItemsByKeywordsString(
+            const std::string& keywordsString, const int maxItems,
+            const unsigned int minKeywordLength, bool uniqueUrls,
+            const HistorySearchWorker::CancelCheck& isCancelled);
     std::shared_ptr<HistoryItemVector> getHistoryItems(bp_history_date_defs period = BP_HISTORY_DATE_TODAY);
-    bool isDuplicate(const char* url) const;
+    int findHistoryId(const std::string & url);
+
+    /**
+     * @brief Queries the database for the most recently created item of the
+     * url, used until the url index is built.
+     * @return id of the item or 0, if there is no such item
+     */
+    int queryHistoryId(const std::string & url, bp_history_date_defs period);
+
+    /**
+     * @brief Queries the database for items, which urls contain all keywords,
+     * used until the url matching index is built.
+     */
+    std::shared_ptr<HistoryItemVector> queryHistoryItemsByKeywords(
+            std::vector<std::string> keywords, const int maxItems, bool uniqueUrls);
+
+    /**
+     * @brief Writes journal entries, called on the journal worker thread.
+     */
+    void writeHistoryEntries(const std::vector<HistoryJournal::Entry>& entries);
+
+    /**
+     * @brief Adds visits of the url, today's history item of the url is
+     * reused, if there is one.
+     * @return id of the history item, 0 on error
+     */
+    int writeHistoryVisit(const std::string & url, const std::string & title, int visits);
+    void writeHistoryFavicon(const std::string & url, tools::BrowserImagePtr favicon);
+    void writeHistorySnapshot(int id, tools::BrowserImagePtr snapshot);
+
+    /**
+     * @brief Finds today's history item of the url and adds visits to it.
+     * @return id of the item or 0, if there is no such item
+     */
+    int visitDuplicate(const std::string& url, int visits);
 };
 
 }
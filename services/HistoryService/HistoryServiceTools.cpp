@@ -14,7 +14,11 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <unordered_set>
 #include <boost/algorithm/string.hpp>
+#include "Tools/KeywordMatcher.h"
+#include "Tools/LatencyTracer.h"
 #include "Tools/StringTools.h"
 #include "HistoryServiceTools.h"
 #include "HistoryItem.h"
@@ -22,38 +26,67 @@
 namespace tizen_browser {
 namespace services {
 
+bool prepareSearchKeywords(const string& keywordsString,
+        unsigned minKeywordLength, vector<string>& keywords)
+{
+    keywords.clear();
+    tools::string_tools::splitString(keywordsString, keywords);
+    if (keywords.empty())
+        return false;
+
+    // the longer the keyword is, the faster search will be
+    const unsigned longestKeywordPos = tools::string_tools::getLongest(keywords);
+    if (keywords[longestKeywordPos].length() < minKeywordLength)
+        return false;
+
+    // longest keyword goes first, it selects candidates in the index
+    swap(keywords.front(), keywords[longestKeywordPos]);
+    tools::string_tools::downcase(keywords);
+    return true;
+}
+
 void removeMismatches(shared_ptr<HistoryItemVector> historyItems,
         const vector<string>& keywords)
 {
+    tools::ScopedLatency latency(tools::autocomplete_stage::REMOVE_MISMATCHES);
+    const tools::KeywordMatcher matcher(keywords);
     for (auto itItem = historyItems->begin(); itItem != historyItems->end();)
-        if (!tools::string_tools::stringMatchesKeywords((*itItem)->getUrl(),
-                keywords.begin(), keywords.end()))
+        if (!matcher.matchesAll((*itItem)->getUrl()))
             // remove url not matching all keywords
             itItem = historyItems->erase(itItem);
         else
             ++itItem;
 }
 
-bool containsDuplicates(std::shared_ptr<HistoryItemVector> vec,
-        std::shared_ptr<HistoryItem> checked)
+void getUrlDuplicateKeyRange(const string& url, size_t& begin, size_t& end)
+{
+    begin = url.find("://");
+    begin = (begin == string::npos) ? 0 : begin + 3;
+    if (url.compare(begin, 4, "www.") == 0)
+        begin += 4;
+    end = url.length();
+    if (end > begin && url[end - 1] == '/')
+        --end;
+}
+
+string getUrlDuplicateKey(const string& url)
 {
-    bool found = false;
-    for (auto& s : *vec)
-        if (s->getUrl().compare(checked->getUrl()) == 0) {
-            if (found)
-                return true;
-            found = true;
-        }
-    return false;
+    // lower case, like urls of HistoryMatchIndex
+    const string lowerUrl(boost::algorithm::to_lower_copy(url));
+    size_t begin, end;
+    getUrlDuplicateKeyRange(lowerUrl, begin, end);
+    return lowerUrl.substr(begin, end - begin);
 }
 
 void removeUrlDuplicates(std::shared_ptr<HistoryItemVector> historyItems)
 {
-    for (auto itItem = historyItems->begin(); itItem != historyItems->end();)
-        if (containsDuplicates(historyItems, *itItem))
-            itItem = historyItems->erase(itItem);
-        else
-            ++itItem;
+    tools::ScopedLatency latency(tools::autocomplete_stage::REMOVE_URL_DUPLICATES);
+    unordered_set<string> seen;
+    seen.reserve(historyItems->size());
+    historyItems->erase(remove_if(historyItems->begin(), historyItems->end(),
+            [&seen](const shared_ptr<HistoryItem>& item) {
+                return !seen.insert(getUrlDuplicateKey(item->getUrl())).second;
+            }), historyItems->end());
 }
 
 } /* namespace services */
@@ -27,24 +27,46 @@ using namespace std;
 namespace tizen_browser {
 namespace services {
 
+/**
+ * @brief Splits keywords string and lowercases keywords for matching.
+ * @param keywordsString string entered by user
+ * @param minKeywordLength minimal length of the longest keyword
+ * @param keywords vector filled with keywords, the longest one first
+ * @return false if there is no keyword at least minKeywordLength long
+ */
+bool prepareSearchKeywords(const string& keywordsString,
+        unsigned minKeywordLength, vector<string>& keywords);
+
 /**
  * @brief Removes history items not matching given keywords
  * @param historyItems Vector from which mismatching items will be removed
  * @param keywords Keywords (history item is a match, when all keywords are
- * matching)
+ * matching, case insensitive)
  */
 void removeMismatches(std::shared_ptr<HistoryItemVector> historyItems,
         const vector<string>& keywords);
 
 /**
- * @brief Returns true, if vector contains at least two items with the same url.
+ * @brief Finds part of the url, which identifies duplicates: url without
+ * scheme, "www." and trailing slash (like tools::clearURL, but "www." is
+ * skipped too).
+ * @param url checked url
+ * @param begin set to the beginning of the part, after scheme and "www."
+ * @param end set to the end of the part, before trailing slash
+ */
+void getUrlDuplicateKeyRange(const string& url, size_t& begin, size_t& end);
+
+/**
+ * @brief Returns url part found by getUrlDuplicateKeyRange, in lower case.
  */
-bool containsDuplicates(std::shared_ptr<HistoryItemVector> vec,
-        std::shared_ptr<HistoryItem> checked);
+string getUrlDuplicateKey(const string& url);
 
 /**
- * @brief Removes history items with urls duplicating other items.
- * In the end, vector has items with unique URLs.
+ * @brief Removes history items with urls duplicating preceding items, in one
+ * pass. Urls are compared without scheme, "www." and trailing slash,
+ * ignoring case, so http://www.example.com/ and https://Example.com are
+ * duplicates.
+ * In the end, vector has items with unique URLs, in the same order.
  */
 void removeUrlDuplicates(std::shared_ptr<HistoryItemVector> historyItems);
 
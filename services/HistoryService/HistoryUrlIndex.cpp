@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <algorithm>
+#include "HistoryUrlIndex.h"
+
+namespace tizen_browser {
+namespace services {
+
+void HistoryUrlIndex::insert(int id, const std::string& url, std::time_t created)
+{
+    remove(id);
+    auto itEntries = m_entries.emplace(url, Entries()).first;
+    Entries& entries = itEntries->second;
+    // new entries are created now, so appending is the common case
+    auto it = std::upper_bound(entries.begin(), entries.end(), created,
+            [](std::time_t time, const Entry& entry) { return time < entry.created; });
+    entries.insert(it, Entry{id, created});
+    m_urls[id] = &itEntries->first;
+}
+
+void HistoryUrlIndex::remove(int id)
+{
+    auto url = m_urls.find(id);
+    if (url == m_urls.end())
+        return;
+    auto itEntries = m_entries.find(*url->second);
+    if (itEntries != m_entries.end()) {
+        Entries& entries = itEntries->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                [id](const Entry& entry) { return entry.id == id; }), entries.end());
+        if (entries.empty())
+            m_entries.erase(itEntries);
+    }
+    m_urls.erase(url);
+}
+
+void HistoryUrlIndex::clear()
+{
+    m_entries.clear();
+    m_urls.clear();
+}
+
+int HistoryUrlIndex::find(const std::string& url, std::time_t since) const
+{
+    auto it = m_entries.find(url);
+    if (it == m_entries.end())
+        return 0;
+    const Entry& latest = it->second.back();
+    return latest.created >= since ? latest.id : 0;
+}
+
+} /* namespace services */
+} /* namespace tizen_browser */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef HISTORYURLINDEX_H_
+#define HISTORYURLINDEX_H_
+
+#include <ctime>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace tizen_browser {
+namespace services {
+
+/**
+ * @brief In-memory index of history entries by exact url.
+ *
+ * Every url is kept once, with ids of its entries and their creation
+ * dates, history has one entry of the url per day. Finding the entry, to
+ * which a visit is added, does not touch the database then.
+ *
+ * Index has to be kept in sync with the database by HistoryService.
+ */
+class HistoryUrlIndex
+{
+public:
+    HistoryUrlIndex() = default;
+    // entries refer to url keys, index can be moved, but not copied
+    HistoryUrlIndex(const HistoryUrlIndex&) = delete;
+    HistoryUrlIndex& operator=(const HistoryUrlIndex&) = delete;
+    HistoryUrlIndex(HistoryUrlIndex&&) = default;
+    HistoryUrlIndex& operator=(HistoryUrlIndex&&) = default;
+
+    /**
+     * @brief Adds entry to the index. If entry with given id already exists,
+     * it is replaced.
+     */
+    void insert(int id, const std::string& url, std::time_t created);
+
+    /**
+     * @brief Removes entry from the index.
+     */
+    void remove(int id);
+
+    /**
+     * @brief Removes all entries.
+     */
+    void clear();
+
+    std::size_t size() const { return m_urls.size(); }
+
+    /**
+     * @return id of the most recently created entry of the url, which was
+     * created at since or later, 0 if there is no such entry
+     */
+    int find(const std::string& url, std::time_t since = 0) const;
+
+private:
+    struct Entry
+    {
+        int id;
+        std::time_t created;
+    };
+    // entries of the url sorted by creation date, the most recent last
+    using Entries = std::vector<Entry>;
+
+    std::unordered_map<std::string, Entries> m_entries;
+    // urls of entries point to keys of m_entries, which are never moved
+    std::unordered_map<int, const std::string*> m_urls;
+};
+
+} /* namespace services */
+} /* namespace tizen_browser */
+
+#endif /* HISTORYURLINDEX_H_ */
@@ -38,15 +38,26 @@ using WebsiteHistoryItemData = struct WebsiteHistoryItemData_
 {
     WebsiteHistoryItemData_(const std::string& websiteTitle,
             const std::string& websiteDomain,
-            std::shared_ptr<tools::BrowserImage> favIcon,
             const WebsiteVisitItemDataPtr& item) :
             websiteTitle(websiteTitle), websiteDomain(websiteDomain),
-            favIcon(favIcon), websiteVisitItem(item)
+            websiteVisitItem(item)
     {
     }
+
+    /**
+     * Favicon is read from the database on the first call (when list item
+     * content is created), nullptr if website has no favicon.
+     */
+    std::shared_ptr<tools::BrowserImage> getFavIcon() const
+    {
+        auto favIcon(websiteVisitItem->historyItem->getFavIcon());
+        if (!favIcon || favIcon->getSize() == 0)
+            return nullptr;
+        return favIcon;
+    }
+
     const std::string websiteTitle;
     const std::string websiteDomain;
-    std::shared_ptr<tools::BrowserImage> favIcon;
     const WebsiteVisitItemDataPtr websiteVisitItem;
 };
 
@@ -58,7 +69,8 @@ using HistoryDayItemData = struct HistoryDayItemData_
     {
     }
     const std::string day;
-    const std::vector<WebsiteHistoryItemDataPtr> websiteHistoryItems;
+    // grows when next pages of history are loaded
+    std::vector<WebsiteHistoryItemDataPtr> websiteHistoryItems;
     bool expanded;
 };
 
@@ -43,6 +43,8 @@ public:
     boost::signals2::signal<void (int)> signalDeleteHistoryItems;
     boost::signals2::signal<void (bool)> setRightButtonEnabledForHistory;
     boost::signals2::signal<void (int)> setSelectedItemsCount;
+    // (period, offset) next page of history items should be added
+    boost::signals2::signal<void (HistoryPeriod, int)> signalHistoryPageRequested;
 };
 
 }
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <services/HistoryUI/HistoryUI.h>
 #include <services/HistoryService/HistoryItem.h>
 #include "BrowserLogger.h"
@@ -46,6 +47,7 @@ HistoryDaysListManagerMob::HistoryDaysListManagerMob()
     , m_isSelectAllChecked(EINA_FALSE)
     , m_downloadManagerItem(nullptr)
     , m_selectAllItem(nullptr)
+    , m_pageRequestJob(nullptr)
 {
     createGenlistItemClasses();
     connectSignals();
@@ -56,6 +58,8 @@ HistoryDaysListManagerMob::~HistoryDaysListManagerMob()
     for (auto& dayItem : m_dayItems)
         dayItem->setEflObjectsAsDeleted();
 
+    clearPeriodItems();
+
     if (m_history_day_item_class)
         elm_genlist_item_class_free(m_history_day_item_class);
 
@@ -220,7 +224,7 @@ Evas_Object* HistoryDaysListManagerMob::_genlist_history_item_content_get(void *
 {
     if (data && !strcmp(part, "elm.swallow.icon")) {
         auto item(static_cast<ItemData*>(data));
-        auto favicon(item->websiteHistoryItemData->favIcon);
+        auto favicon(item->websiteHistoryItemData->getFavIcon());
         if (!favicon) {
             auto no_icon(elm_icon_add(obj));
             elm_image_resizable_set(no_icon, EINA_TRUE, EINA_TRUE);
@@ -295,7 +299,9 @@ Evas_Object* HistoryDaysListManagerMob::createDaysList(
     evas_object_smart_callback_add(m_genlist, "expanded", _tree_item_expanded, this);
     evas_object_smart_callback_add(m_genlist, "contracted", _tree_item_contracted, this);
     evas_object_smart_callback_add(m_genlist, "pressed", _tree_item_pressed, this);
+    evas_object_smart_callback_add(m_genlist, "realized", _item_realized, this);
     m_history_count = 0;
+    clearPeriodItems();
     auto id(new ItemData);
     id->self = this;
     id->websiteVisitItem = nullptr;
@@ -327,23 +333,78 @@ void HistoryDaysListManagerMob::addHistoryItems(
     HistoryPeriod period)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    const bool hasMore = items->size() >= static_cast<size_t>(HistoryUI::HISTORY_PAGE_SIZE);
+    auto periodItem(m_periodItems.find(period));
+    if (periodItem == m_periodItems.end()) {
+        // first page, period is shown only when it has any history
+        if (items->empty())
+            return;
+        auto dayItem(std::make_shared<HistoryDayItemData>(
+            toString(period), createWebsiteHistoryItems(items)));
+        auto el(appendDayItem(dayItem));
+        m_periodItems[period] = PeriodItem{dayItem, el,
+            static_cast<int>(items->size()), hasMore, false};
+        showNoHistoryMessage(isHistoryDayListEmpty());
+        return;
+    }
+
+    auto& periodData(periodItem->second);
+    periodData.pageRequested = false;
+    periodData.hasMore = hasMore;
+    periodData.loadedCount += items->size();
+    auto historyItems(createWebsiteHistoryItems(items));
+    auto& dayItems(periodData.dayItemData->websiteHistoryItems);
+    dayItems.insert(dayItems.end(), historyItems.begin(), historyItems.end());
+    if (auto dayItem = getItem(periodData.dayItemData))
+        dayItem->addItems(historyItems);
+    if (periodData.dayItemData->expanded)
+        for (auto& el : historyItems)
+            appendWebsiteHistoryItem(periodData.item, el);
+}
+
+std::vector<WebsiteHistoryItemDataPtr> HistoryDaysListManagerMob::createWebsiteHistoryItems(
+    const std::shared_ptr<services::HistoryItemVector>& items)
+{
     std::vector<WebsiteHistoryItemDataPtr> historyItems;
+    historyItems.reserve(items->size());
     for (auto& item : *items) {
         auto pageViewItem(std::make_shared<WebsiteVisitItemData>(item));
-        auto websiteFavicon(item->getFavIcon());
-        if (!websiteFavicon || websiteFavicon->getSize() == 0)
-            websiteFavicon = nullptr;
         historyItems.push_back(
             std::make_shared<WebsiteHistoryItemData>(
                 item->getTitle(),
                 item->getUrl(),
-                websiteFavicon,
                 pageViewItem));
         ++m_history_count;
     }
-    auto dayItem(std::make_shared<HistoryDayItemData>(toString(period), historyItems));
-    appendDayItem(dayItem);
-    showNoHistoryMessage(isHistoryDayListEmpty());
+    return historyItems;
+}
+
+void HistoryDaysListManagerMob::forgetLoadedItem(int historyItemId)
+{
+    // next page offset counts rows left in the database, deleted rows
+    // would be skipped otherwise
+    for (auto& period : m_periodItems) {
+        auto& dayItems(period.second.dayItemData->websiteHistoryItems);
+        auto it(std::find_if(dayItems.begin(), dayItems.end(),
+            [historyItemId](const WebsiteHistoryItemDataPtr& item) {
+                return item->websiteVisitItem->historyItem->getId() == historyItemId;
+            }));
+        if (it != dayItems.end()) {
+            dayItems.erase(it);
+            --period.second.loadedCount;
+            return;
+        }
+    }
+}
+
+void HistoryDaysListManagerMob::clearPeriodItems()
+{
+    m_periodItems.clear();
+    m_requestedPages.clear();
+    if (m_pageRequestJob) {
+        ecore_job_del(m_pageRequestJob);
+        m_pageRequestJob = nullptr;
+    }
 }
 
 void HistoryDaysListManagerMob::clear()
@@ -351,6 +412,7 @@ void HistoryDaysListManagerMob::clear()
     elm_box_clear(m_boxDays);
     m_dayItems.clear();
     elm_genlist_clear(m_genlist);
+    clearPeriodItems();
     showNoHistoryMessage(isHistoryDayListEmpty());
 }
 
@@ -381,24 +443,8 @@ void HistoryDaysListManagerMob::_tree_item_expanded(void* data, Evas_Object* gen
     }
     auto it(static_cast<Elm_Object_Item*>(event_info));
     auto self(static_cast<HistoryDaysListManagerMob*>(data));
-    for (auto& el : self->m_itemData[it]->websiteHistoryItems) {
-        auto itData(new ItemData);
-        itData->self = self;
-        itData->websiteVisitItem = el->websiteVisitItem;
-        itData->websiteHistoryItemData = el;
-        itData->str = nullptr;
-        auto listItem(
-            elm_genlist_item_append(
-                genlist,
-                self->m_history_item_item_class,
-                itData,
-                it,
-                ELM_GENLIST_ITEM_NONE,
-                _item_selected,
-                itData));
-        self->m_itemsToDelete[listItem] = EINA_FALSE;
-        self->m_visitItemData[listItem] = el->websiteVisitItem;
-    }
+    for (auto& el : self->m_itemData[it]->websiteHistoryItems)
+        self->appendWebsiteHistoryItem(it, el);
     self->m_itemData[it]->expanded = true;
     auto arrow_layout(
         elm_object_item_part_content_get(it, "elm.swallow.end"));
@@ -407,6 +453,70 @@ void HistoryDaysListManagerMob::_tree_item_expanded(void* data, Evas_Object* gen
     elm_genlist_realized_items_update(genlist);
 }
 
+Elm_Object_Item* HistoryDaysListManagerMob::appendWebsiteHistoryItem(
+    Elm_Object_Item* dayItem, WebsiteHistoryItemDataPtr websiteHistoryItemData)
+{
+    auto itData(new ItemData);
+    itData->self = this;
+    itData->websiteVisitItem = websiteHistoryItemData->websiteVisitItem;
+    itData->websiteHistoryItemData = websiteHistoryItemData;
+    itData->str = nullptr;
+    auto listItem(
+        elm_genlist_item_append(
+            m_genlist,
+            m_history_item_item_class,
+            itData,
+            dayItem,
+            ELM_GENLIST_ITEM_NONE,
+            _item_selected,
+            itData));
+    m_itemsToDelete[listItem] = EINA_FALSE;
+    m_visitItemData[listItem] = websiteHistoryItemData->websiteVisitItem;
+    return listItem;
+}
+
+void HistoryDaysListManagerMob::_item_realized(void* data, Evas_Object*, void* event_info)
+{
+    if (!(data && event_info))
+        return;
+    auto it(static_cast<Elm_Object_Item*>(event_info));
+    auto self(static_cast<HistoryDaysListManagerMob*>(data));
+    auto parent(elm_genlist_item_parent_get(it));
+    if (!parent)
+        return;
+    auto itData(static_cast<ItemData*>(elm_object_item_data_get(it)));
+    for (auto& period : self->m_periodItems) {
+        auto& periodData(period.second);
+        if (periodData.item != parent)
+            continue;
+        // the last loaded item became visible, ask for the next page
+        const auto& dayItems(periodData.dayItemData->websiteHistoryItems);
+        if (periodData.hasMore && !periodData.pageRequested && itData &&
+            !dayItems.empty() && itData->websiteHistoryItemData == dayItems.back()) {
+            periodData.pageRequested = true;
+            self->m_requestedPages.push_back(period.first);
+            // genlist can't be modified from its own realized callback
+            if (!self->m_pageRequestJob)
+                self->m_pageRequestJob = ecore_job_add(_request_history_pages, self);
+        }
+        return;
+    }
+}
+
+void HistoryDaysListManagerMob::_request_history_pages(void* data)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    auto self(static_cast<HistoryDaysListManagerMob*>(data));
+    self->m_pageRequestJob = nullptr;
+    std::vector<HistoryPeriod> requestedPages;
+    requestedPages.swap(self->m_requestedPages);
+    for (auto period : requestedPages) {
+        auto periodItem(self->m_periodItems.find(period));
+        if (periodItem != self->m_periodItems.end())
+            self->signalHistoryPageRequested(period, periodItem->second.loadedCount);
+    }
+}
+
 void HistoryDaysListManagerMob::_item_selected(void* data, Evas_Object *, void *)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
@@ -446,7 +556,7 @@ void HistoryDaysListManagerMob::_tree_item_contracted(void* data, Evas_Object*,
     edje_object_signal_emit(edje, "state,contracted,signal", "");
 }
 
-void HistoryDaysListManagerMob::appendDayItem(HistoryDayItemDataPtr dayItemData)
+Elm_Object_Item* HistoryDaysListManagerMob::appendDayItem(HistoryDayItemDataPtr dayItemData)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     auto item(std::make_shared<HistoryDayItemMob>(dayItemData));
@@ -460,6 +570,7 @@ void HistoryDaysListManagerMob::appendDayItem(HistoryDayItemDataPtr dayItemData)
 
     m_itemData[el] = dayItemData;
     m_expandedState[el] = EINA_FALSE;
+    return el;
 }
 
 void HistoryDaysListManagerMob::showNoHistoryMessage(bool show)
@@ -476,6 +587,7 @@ void HistoryDaysListManagerMob::onWebsiteHistoryItemVisitItemClicked(
 {
     if (remove) {
         removeItem(clickedItem);
+        forgetLoadedItem(clickedItem->historyItem->getId());
         signalDeleteHistoryItems(clickedItem->historyItem->getId());
     } else
         signalHistoryItemClicked(
@@ -532,6 +644,7 @@ void HistoryDaysListManagerMob::removeItem(
     for (auto& dayItem : m_dayItems) {
         auto websiteHistoryItem(dayItem->getItem(websiteHistoryItemData));
         if (websiteHistoryItem) {
+            forgetLoadedItem(websiteHistoryItem->getVisitItemsId());
             signalDeleteHistoryItems(websiteHistoryItem->getVisitItemsId());
             dayItem->removeItem(websiteHistoryItemData);
             return;
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <Ecore.h>
 #include <EflTools.h>
 
 #include "HistoryDayItemDataTypedef.h"
@@ -49,6 +50,8 @@ public:
     static void _tree_item_contracted(void*, Evas_Object*, void*);
     static void _tree_item_pressed(void*, Evas_Object*, void*);
     static void _item_selected(void *data, Evas_Object *obj, void *event_info);
+    static void _item_realized(void *data, Evas_Object *obj, void *event_info);
+    static void _request_history_pages(void *data);
     static Evas_Object* _genlist_history_download_content_get(void*, Evas_Object* obj, const char *part);
     static Evas_Object* _genlist_history_item_content_get(void *data, Evas_Object *, const char *part);
     static Evas_Object* _genlist_history_day_content_get(void *data, Evas_Object* obj, const char *part);
@@ -75,8 +78,25 @@ private:
         WebsiteHistoryItemDataPtr websiteHistoryItemData;
         const char* str;
     };
+    // history of each period is loaded in pages, when user scrolls to its end
+    struct PeriodItem {
+        HistoryDayItemDataPtr dayItemData;
+        Elm_Object_Item* item;
+        int loadedCount;
+        bool hasMore;
+        bool pageRequested;
+    };
     void connectSignals();
-    void appendDayItem(HistoryDayItemDataPtr dayItemData);
+    Elm_Object_Item* appendDayItem(HistoryDayItemDataPtr dayItemData);
+    Elm_Object_Item* appendWebsiteHistoryItem(Elm_Object_Item* dayItem,
+        WebsiteHistoryItemDataPtr websiteHistoryItemData);
+    std::vector<WebsiteHistoryItemDataPtr> createWebsiteHistoryItems(
+        const std::shared_ptr<services::HistoryItemVector>& items);
+    void clearPeriodItems();
+    /**
+     * @brief Removes deleted history item from loaded items of its period.
+     */
+    void forgetLoadedItem(int historyItemId);
     void showNoHistoryMessage(bool show);
     bool isHistoryDayListEmpty() {return m_dayItems.empty();}
 
@@ -124,6 +144,9 @@ private:
     Eina_Bool m_isSelectAllChecked;
     Elm_Object_Item* m_downloadManagerItem;
     Elm_Object_Item* m_selectAllItem;
+    std::map<HistoryPeriod, PeriodItem> m_periodItems;
+    std::vector<HistoryPeriod> m_requestedPages;
+    Ecore_Job* m_pageRequestJob;
 };
 
 } /* namespace base_ui */
@@ -33,7 +33,13 @@ HistoryDayItemMob::HistoryDayItemMob(HistoryDayItemDataPtr dayItemData)
     , m_layoutHeader(nullptr)
     , m_boxHeader(nullptr)
 {
-    for (auto& websiteHistoryItemData : dayItemData->websiteHistoryItems) {
+    addItems(dayItemData->websiteHistoryItems);
+}
+
+void HistoryDayItemMob::addItems(
+        const std::vector<WebsiteHistoryItemDataPtr>& websiteHistoryItems)
+{
+    for (auto& websiteHistoryItemData : websiteHistoryItems) {
         auto websiteHistoryItem =
                 std::make_shared<WebsiteHistoryItemMob>(websiteHistoryItemData);
         m_websiteHistoryItems.push_back(websiteHistoryItem);
@@ -39,6 +39,11 @@ public:
             HistoryDaysListManagerEdjePtr edjeFiles);
     Evas_Object* getLayoutMain() {return m_layoutMain;}
 
+    /**
+     * @brief add items of the next history page
+     */
+    void addItems(const std::vector<WebsiteHistoryItemDataPtr>& websiteHistoryItems);
+
     WebsiteHistoryItemMobPtr getItem(
             WebsiteHistoryItemDataPtrConst historyDayItemData);
     /**
@@ -215,8 +215,9 @@ Evas_Object* WebsiteHistoryItemTitleMob::createLayoutIcon(Evas_Object* parent,
     Evas_Object* layout = elm_layout_add(parent);
     elm_layout_file_set(layout, edjeFilePath.c_str(), "layoutItemIcon");
 
-    if (m_websiteHistoryItemData->favIcon) {
-        m_imageFavIcon = m_websiteHistoryItemData->favIcon->getEvasImage(parent);
+    auto favIcon(m_websiteHistoryItemData->getFavIcon());
+    if (favIcon) {
+        m_imageFavIcon = favIcon->getEvasImage(parent);
         elm_object_part_content_set(layout, "swallowFavIcon", m_imageFavIcon);
     }
 
@@ -59,6 +59,7 @@ HistoryUI::HistoryUI()
 
     m_historyDaysListManager->signalHistoryItemClicked.connect(signalHistoryItemClicked);
     m_historyDaysListManager->signalDeleteHistoryItems.connect(signalDeleteHistoryItems);
+    m_historyDaysListManager->signalHistoryPageRequested.connect(historyPageRequested);
     m_historyDaysListManager->setRightButtonEnabledForHistory.connect(
         boost::bind(&HistoryUI::setRightButtonEnabled, this, _1));
     m_historyDaysListManager->setSelectedItemsCount.connect([this](auto count){
@@ -176,8 +177,7 @@ void HistoryUI::addHistoryItems(
     HistoryPeriod period)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    if (items->size() == 0)
-        return;
+    // empty page is passed as well, it ends loading of the period
     m_historyDaysListManager->addHistoryItems(items, period);
 }
 
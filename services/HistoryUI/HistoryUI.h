@@ -55,6 +55,10 @@ public:
     Evas_Object* createDaysList(Evas_Object* history_layout, bool isRemoveMode = false);
     void removeSelectedHistoryItems();
     virtual std::string getName();
+    /**
+     * @brief Adds page of history items of given period. The first page
+     * creates period on the list, next pages are appended to it.
+     */
     void addHistoryItems(std::shared_ptr<services::HistoryItemVector>,
             HistoryPeriod period = HistoryPeriod::HISTORY_TODAY);
     void addItems();
@@ -67,6 +71,11 @@ public:
     boost::signals2::signal<void ()> clearHistoryClicked;
     boost::signals2::signal<void (int)> signalDeleteHistoryItems;
     boost::signals2::signal<void (std::string url, std::string title)> signalHistoryItemClicked;
+    // (period, offset) user scrolled to the end of loaded history items
+    boost::signals2::signal<void (HistoryPeriod, int)> historyPageRequested;
+
+    // number of history items requested at once for each period
+    static const int HISTORY_PAGE_SIZE = 50;
 private:
     void clearItems();
     void createHistoryUILayout();
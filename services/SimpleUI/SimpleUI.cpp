@@ -19,6 +19,7 @@
 #include <boost/any.hpp>
 #include <memory>
 #include <algorithm>
+#include <iterator>
 #include <Elementary.h>
 #include <Ecore.h>
 #include <Ecore_Wayland.h>
@@ -31,6 +32,7 @@
 #include "TabOrigin.h"
 #include "HistoryUI.h"
 #include "FindOnPageUI.h"
+#include "StartupTimeline.h"
 #include "SettingsUI.h"
 #include "SettingsMain.h"
 #include "SettingsHomePage.h"
@@ -74,6 +76,7 @@
 #include "NotificationPopup.h"
 #include "RadioPopup.h"
 #include "Tools/GeneralTools.h"
+#include "Tools/LatencyTracer.h"
 #include "Tools/SnapshotType.h"
 #include "SettingsPrettySignalConnector.h"
 #include "net_connection.h"
@@ -122,6 +125,8 @@ SimpleUI::SimpleUI()
     config::Config::getInstance().set(
             "scale", static_cast<double>(elm_config_scale_get()/config_scale_value));
     m_tabLimit = boost::any_cast<int>(config::Config::getInstance().get("TAB_LIMIT"));
+    tools::LatencyTracer::getInstance().setEnabled(boost::any_cast<bool>(
+            config::Config::getInstance().get(CONFIG_KEY::URLHISTORYLIST_LATENCY_TRACING)));
 
     elm_win_conformant_set(main_window, EINA_TRUE);
     if (main_window == nullptr)
@@ -154,6 +159,9 @@ SimpleUI::~SimpleUI() {
 void SimpleUI::suspend()
 {
     m_webEngine->suspend();
+    m_storageService->getSettingsStorage().flush();
+    m_historyService->flush();
+    tools::LatencyTracer::getInstance().dump();
 }
 
 void SimpleUI::resume()
@@ -173,6 +181,8 @@ void SimpleUI::destroyUI()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     m_webEngine->destroyTabs();
+    m_storageService->getSettingsStorage().flush();
+    m_historyService->flush();
 }
 
 std::shared_ptr<services::HistoryItemVector> SimpleUI::getMostVisitedItems()
@@ -193,6 +203,7 @@ std::shared_ptr<services::HistoryItemVector> SimpleUI::getHistory()
 
 void SimpleUI::prepareServices()
 {
+    tools::ScopedStartupEvent event("prepare services");
     loadUIServices();
     loadModelServices();
 
@@ -262,6 +273,7 @@ int SimpleUI::exec(const std::string& _url, const std::string& _caller, const st
                 restoreLastSession();
             }
             m_initialised = true;
+            tools::StartupTimeline::getInstance().dump();
         }
         std::string pwaUrl = std::string();
 #if PWA
@@ -330,14 +342,25 @@ void SimpleUI::restoreLastSession()
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
 
     auto vec(m_tabService->getAllTabs());
-    for (const auto& i : *vec) {
-        openNewTab(
-            i.getUrl(),
-            i.getTitle(),
-            boost::optional<int>(i.getId().get()),
+    if (vec->empty())
+        return;
+
+    // only the last tab is loaded now, others are loaded, when switched to
+    for (auto i = vec->begin(); i != std::prev(vec->end()); ++i) {
+        m_webEngine->addDiscardedTab(
+            i->getUrl(),
+            boost::optional<int>(i->getId().get()),
+            i->getTitle(),
             false,
-            i.getOrigin());
+            i->getOrigin());
     }
+    const auto& last = vec->back();
+    openNewTab(
+        last.getUrl(),
+        last.getTitle(),
+        boost::optional<int>(last.getId().get()),
+        false,
+        last.getOrigin());
 }
 
 void SimpleUI::loadUIServices()
@@ -352,10 +375,6 @@ void SimpleUI::loadUIServices()
         std::dynamic_pointer_cast<base_ui::QuickAccess, core::AbstractService>(
             core::ServiceManager::getInstance().getService("org.tizen.browser.quickaccess"));
 
-    m_historyUI =
-        std::dynamic_pointer_cast<base_ui::HistoryUI, core::AbstractService>(
-            core::ServiceManager::getInstance().getService("org.tizen.browser.historyui"));
-
     m_tabUI =
         std::dynamic_pointer_cast<base_ui::TabUI, core::AbstractService>(
             core::ServiceManager::getInstance().getService("org.tizen.browser.tabui"));
@@ -370,11 +389,6 @@ void SimpleUI::loadUIServices()
             std::dynamic_pointer_cast<base_ui::BookmarkFlowUI, core::AbstractService>(
                 core::ServiceManager::getInstance().getService("org.tizen.browser.bookmarkflowui"));
     }));
-    auto futureFindOnPage(std::async(std::launch::async, [this](){
-        m_findOnPageUI =
-            std::dynamic_pointer_cast<base_ui::FindOnPageUI, core::AbstractService>(
-                core::ServiceManager::getInstance().getService("org.tizen.browser.findonpageui"));
-    }));
     auto futureBookmarksMan(std::async(std::launch::async, [this](){
         m_bookmarkManagerUI =
             std::dynamic_pointer_cast<base_ui::BookmarkManagerUI, core::AbstractService>(
@@ -382,7 +396,6 @@ void SimpleUI::loadUIServices()
     }));
     futureSettings.get();
     futureBookmarkFlow.get();
-    futureFindOnPage.get();
     futureBookmarksMan.get();
 }
 
@@ -469,7 +482,7 @@ void SimpleUI::connectWebPageSignals()
     m_webPageUI->deleteBookmark.connect(boost::bind(&SimpleUI::deleteBookmark, this));
     m_webPageUI->showBookmarkFlowUI.connect(boost::bind(&SimpleUI::showBookmarkFlowUI, this));
     m_webPageUI->showFindOnPageUI.connect(boost::bind(&SimpleUI::showFindOnPageUI, this, std::string()));
-    m_webPageUI->isFindOnPageVisible.connect(boost::bind(&FindOnPageUI::isVisible, m_findOnPageUI.get()));
+    m_webPageUI->isFindOnPageVisible.connect([this]() { return m_findOnPageUI && m_findOnPageUI->isVisible(); });
     m_webPageUI->showSettingsUI.connect(boost::bind(&SettingsManager::showSettingsBaseUI, m_settingsManager.get()));
     m_webPageUI->addNewTab.connect(boost::bind(&SimpleUI::newTabClicked, this));
     m_webPageUI->getURIEntry().mobileEntryFocused.connect(boost::bind(&WebPageUI::mobileEntryFocused, m_webPageUI));
@@ -554,6 +567,7 @@ void SimpleUI::connectHistorySignals()
     M_ASSERT(m_historyUI.get());
     m_historyUI->clearHistoryClicked.connect(boost::bind(&SimpleUI::onClearHistoryAllClicked, this));
     m_historyUI->signalDeleteHistoryItems.connect(boost::bind(&SimpleUI::onDeleteHistoryItems, this, _1));
+    m_historyUI->historyPageRequested.connect(boost::bind(&SimpleUI::onHistoryPageRequested, this, _1, _2));
     m_historyUI->closeHistoryUIClicked.connect(boost::bind(&SimpleUI::popTheStack, this));
     m_historyUI->signalHistoryItemClicked.connect(boost::bind(&SimpleUI::openURL, this, _1, _2, false));
     m_historyUI->getWindow.connect(boost::bind(&SimpleUI::getMainWindow, this));
@@ -583,7 +597,7 @@ void SimpleUI::connectBookmarkManagerSignals()
     m_bookmarkManagerUI->newFolderItemClicked.connect(boost::bind(&SimpleUI::onNewFolderClicked, this, _1));
     m_bookmarkManagerUI->isLandscape.connect(boost::bind(&SimpleUI::isLandscape, this));
     m_bookmarkManagerUI->getHistoryGenlistContent.connect(boost::bind(&SimpleUI::showHistoryUI, this, _1, _2, _3));
-    m_bookmarkManagerUI->removeSelectedItemsFromHistory.connect(boost::bind(&HistoryUI::removeSelectedHistoryItems, m_historyUI.get()));
+    m_bookmarkManagerUI->removeSelectedItemsFromHistory.connect([this]() { getHistoryUI()->removeSelectedHistoryItems(); });
     m_bookmarkManagerUI->isEngineSecretMode.connect(boost::bind(&basic_webengine::AbstractWebEngine::isSecretMode, m_webEngine.get()));
 }
 
@@ -674,7 +688,8 @@ void SimpleUI::connectWebEngineSignals()
     m_webEngine->favIconChanged.connect(boost::bind(&SimpleUI::faviconChanged, this, _1));
     m_webEngine->windowCreated.connect(boost::bind(&SimpleUI::windowCreated, this));
     m_webEngine->createTabId.connect(boost::bind(&SimpleUI::onCreateTabId, this));
-    m_webEngine->snapshotCaptured.connect(boost::bind(&SimpleUI::onSnapshotCaptured, this, _1, _2));
+    m_webEngine->snapshotCaptured.connect(boost::bind(&SimpleUI::onSnapshotCaptured, this, _1, _2, _3, _4));
+    m_webEngine->tabDiscarded.connect(boost::bind(&SimpleUI::onTabDiscarded, this, _1));
     m_webEngine->redirectedWebPage.connect(boost::bind(&SimpleUI::redirectedWebPage, this, _1, _2));
     m_webEngine->rotatePrepared.connect(boost::bind(&SimpleUI::rotatePrepared, this));
     m_webEngine->switchToQuickAccess.connect(boost::bind(&SimpleUI::switchViewToQuickAccess, this));
@@ -693,6 +708,8 @@ void SimpleUI::connectWebEngineSignals()
 void SimpleUI::connectHistoryServiceSignals()
 {
     m_historyService->historyDeleted.connect(boost::bind(&SimpleUI::onHistoryRemoved, this,_1));
+    m_historyService->historyItemsByKeywordsFound.connect(
+        boost::bind(&UrlHistoryList::onURLEntryEditedByUser, m_webPageUI->getUrlHistoryList().get(), _1, _2));
 }
 
 void SimpleUI::connectTabServiceSignals()
@@ -727,10 +744,8 @@ void SimpleUI::connectUISignals()
     connectWebPageSignals();
     connectQuickAccessSignals();
     connectTabsSignals();
-    connectHistorySignals();
     connectSettingsSignals();
     connectBookmarkFlowSignals();
-    connectFindOnPageSignals();
     connectBookmarkManagerSignals();
 }
 
@@ -738,7 +753,7 @@ void SimpleUI::connectModelSignals()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     connectWebEngineSignals();
-    connectHistorySignals();
+    connectHistoryServiceSignals();
     connectTabServiceSignals();
     connectPlatformInputSignals();
     connectCertificateSignals();
@@ -752,35 +767,66 @@ void SimpleUI::initUIServices()
     auto viewManager(m_viewManager.getContent());
 
     M_ASSERT(m_webPageUI.get());
-    m_webPageUI->init(viewManager);
+    {
+        tools::ScopedStartupEvent event("init org.tizen.browser.webpageui");
+        m_webPageUI->init(viewManager);
+    }
 
     auto webPageUI(m_webPageUI->getContent());
     M_ASSERT(m_quickAccess.get());
-    m_quickAccess->init(webPageUI);
+    {
+        tools::ScopedStartupEvent event("init org.tizen.browser.quickaccess");
+        m_quickAccess->init(webPageUI);
+    }
 
     M_ASSERT(m_tabUI.get());
     m_tabUI->init(viewManager);
 
-    M_ASSERT(m_historyUI.get());
-    m_historyUI->init(viewManager);
-
     M_ASSERT(m_bookmarkFlowUI.get());
     m_bookmarkFlowUI->init(viewManager);
 
-    M_ASSERT(m_findOnPageUI.get());
-    m_findOnPageUI->init(webPageUI);
-
     M_ASSERT(m_bookmarkManagerUI.get());
     m_bookmarkManagerUI->init(viewManager);
 }
 
+std::shared_ptr<HistoryUI> SimpleUI::getHistoryUI()
+{
+    if (!m_historyUI) {
+        tools::ScopedStartupEvent event("init org.tizen.browser.historyui");
+        m_historyUI =
+            std::dynamic_pointer_cast<base_ui::HistoryUI, core::AbstractService>(
+                core::ServiceManager::getInstance().getService("org.tizen.browser.historyui"));
+        M_ASSERT(m_historyUI.get());
+        m_historyUI->init(m_viewManager.getContent());
+        connectHistorySignals();
+    }
+    return m_historyUI;
+}
+
+std::shared_ptr<FindOnPageUI> SimpleUI::getFindOnPageUI()
+{
+    if (!m_findOnPageUI) {
+        tools::ScopedStartupEvent event("init org.tizen.browser.findonpageui");
+        m_findOnPageUI =
+            std::dynamic_pointer_cast<base_ui::FindOnPageUI, core::AbstractService>(
+                core::ServiceManager::getInstance().getService("org.tizen.browser.findonpageui"));
+        M_ASSERT(m_findOnPageUI.get());
+        m_findOnPageUI->init(m_webPageUI->getContent());
+        connectFindOnPageSignals();
+    }
+    return m_findOnPageUI;
+}
+
 void SimpleUI::initModelServices()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
 
     M_ASSERT(m_webEngine.get());
     M_ASSERT(m_webPageUI.get());
-    m_webEngine->init(m_webPageUI->getContent());
+    {
+        tools::ScopedStartupEvent event("init org.tizen.browser.webengineservice");
+        m_webEngine->init(m_webPageUI->getContent());
+    }
 
     M_ASSERT(m_storageService->getSettingsStorage());
     m_storageService->getSettingsStorage().initWebEngineSettingsFromDB();
@@ -960,6 +1006,35 @@ void SimpleUI::onDeleteHistoryItems(int id)
     m_historyService->deleteHistoryItem(id);
 }
 
+void SimpleUI::onHistoryPageRequested(HistoryPeriod period, int offset)
+{
+    BROWSER_LOGD("[%s:%d] offset: %d", __PRETTY_FUNCTION__, __LINE__, offset);
+    bp_history_date_defs datePeriod;
+    switch (period) {
+    case HistoryPeriod::HISTORY_TODAY:
+        datePeriod = BP_HISTORY_DATE_TODAY;
+        break;
+    case HistoryPeriod::HISTORY_YESTERDAY:
+        datePeriod = BP_HISTORY_DATE_YESTERDAY;
+        break;
+    case HistoryPeriod::HISTORY_LASTWEEK:
+        datePeriod = BP_HISTORY_DATE_LAST_7_DAYS;
+        break;
+    case HistoryPeriod::HISTORY_LASTMONTH:
+        datePeriod = BP_HISTORY_DATE_LAST_MONTH;
+        break;
+    case HistoryPeriod::HISTORY_OLDER:
+        datePeriod = BP_HISTORY_DATE_OLDER;
+        break;
+    default:
+        BROWSER_LOGE("[%s:%d] not handled period", __PRETTY_FUNCTION__, __LINE__);
+        return;
+    }
+    getHistoryUI()->addHistoryItems(
+        m_historyService->getHistoryPage(datePeriod, offset, HistoryUI::HISTORY_PAGE_SIZE),
+        period);
+}
+
 void SimpleUI::onMostVisitedClicked()
 {
    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
@@ -1199,23 +1274,26 @@ void SimpleUI::onUrlIMEClosed(void* data, Evas_Object*, void*)
     self->setwvIMEStatus(false);
 }
 
-void SimpleUI::onSnapshotCaptured(std::shared_ptr<tools::BrowserImage> snapshot, tools::SnapshotType snapshot_type)
+void SimpleUI::onSnapshotCaptured(std::shared_ptr<tools::BrowserImage> snapshot, tools::SnapshotType snapshot_type,
+    const basic_webengine::TabId& tabId, const std::string& uri)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     switch (snapshot_type) {
     case tools::SnapshotType::ASYNC_LOAD_FINISHED:
         if (m_webEngine->isSecretMode()) {
-            m_tabService->saveThumbCache(m_webEngine->currentTabId(), snapshot);
+            m_tabService->saveThumbCache(tabId, snapshot);
         } else {
-            m_historyService->updateHistoryItemSnapshot(m_webEngine->getURI(), snapshot);
-            m_tabService->updateTabItemSnapshot(m_webEngine->currentTabId(), snapshot);
+            m_historyService->updateHistoryItemSnapshot(uri, snapshot);
+            m_tabService->updateTabItemSnapshot(tabId, snapshot);
         }
+        m_tabUI->updateTabThumbnail(tabId, snapshot);
         break;
     case tools::SnapshotType::ASYNC_TAB:
-        m_tabService->updateTabItemSnapshot(m_webEngine->currentTabId(), snapshot);
+        m_tabService->updateTabItemSnapshot(tabId, snapshot);
+        m_tabUI->updateTabThumbnail(tabId, snapshot);
         break;
     case tools::SnapshotType::ASYNC_BOOKMARK:
-        m_favoriteService->updateBookmarkItemSnapshot(m_webEngine->getURI(), snapshot);
+        m_favoriteService->updateBookmarkItemSnapshot(uri, snapshot);
         break;
     case tools::SnapshotType::SYNC:
         BROWSER_LOGE("Synchronized snapshot in asynchronized workflow");
@@ -1225,6 +1303,14 @@ void SimpleUI::onSnapshotCaptured(std::shared_ptr<tools::BrowserImage> snapshot,
     }
 }
 
+void SimpleUI::onTabDiscarded(basic_webengine::TabContentPtr tab)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    // thumbnail is stored already, by the last snapshot of the tab
+    if (!tab->getIsSecret())
+        m_tabService->updateTabItem(tab->getId(), tab->getUrl(), tab->getTitle(), tab->getOrigin());
+}
+
 void SimpleUI::onGenerateThumb(basic_webengine::TabId tabId)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
@@ -1232,8 +1318,8 @@ void SimpleUI::onGenerateThumb(basic_webengine::TabId tabId)
             tizen_browser::config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_WIDTH));
     const int THUMB_HEIGHT = boost::any_cast<int>(
             tizen_browser::config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_HEIGHT));
-    tools::BrowserImagePtr snapshotImage = m_webEngine->getSnapshotData(tabId, THUMB_WIDTH, THUMB_HEIGHT, false, tools::SnapshotType::SYNC);
-    m_tabService->updateTabItemSnapshot(tabId, snapshotImage);
+    // tab manager shows placeholder until the snapshot is captured
+    m_webEngine->requestSnapshot(tabId, THUMB_WIDTH, THUMB_HEIGHT, tools::SnapshotType::ASYNC_TAB);
 }
 
 void SimpleUI::onGenerateFavicon(basic_webengine::TabId tabId)
@@ -1270,7 +1356,7 @@ void SimpleUI::onXF86BackPressed()
 void SimpleUI::onBackPressed()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    if (m_findOnPageUI->isVisible())
+    if (m_findOnPageUI && m_findOnPageUI->isVisible())
         closeFindOnPageUI();
     else
     if (m_wvIMEStatus) {    // if IME opened
@@ -1484,7 +1570,7 @@ void SimpleUI::loadStarted()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     m_webPageUI->loadStarted();
-    if (m_findOnPageUI->isVisible())
+    if (m_findOnPageUI && m_findOnPageUI->isVisible())
         closeFindOnPageUI();
 }
 
@@ -1514,6 +1600,8 @@ void SimpleUI::filterURL(const std::string& url)
 {
     BROWSER_LOGD("[%s:%d] url=%s", __PRETTY_FUNCTION__, __LINE__, url.c_str());
 
+    // matches for the edited url are not needed anymore
+    m_historyService->cancelHistoryItemsSearch();
     if (url == HomePageURL) {
         m_webPageUI->getURIEntry().changeUri("");
         switchViewToQuickAccess();
@@ -1525,23 +1613,24 @@ void SimpleUI::filterURL(const std::string& url)
 
 void SimpleUI::onURLEntryEditedByUser(const std::shared_ptr<std::string> editedUrlPtr)
 {
+    tools::LatencyTracer::getInstance().start(tools::autocomplete_stage::KEYSTROKE);
+    tools::ScopedLatency latency(tools::autocomplete_stage::URL_ENTRY_EDITED);
     string editedUrl(*editedUrlPtr);
     int historyItemsVisibleMax =
             m_webPageUI->getUrlHistoryList()->getItemsNumberMax();
     int minKeywordLength =
             m_webPageUI->getUrlHistoryList()->getKeywordLengthMin();
-    std::shared_ptr<services::HistoryItemVector> result =
-            m_historyService->getHistoryItemsByKeywordsString(editedUrl,
-                    historyItemsVisibleMax, minKeywordLength, true);
-    m_webPageUI->getUrlHistoryList()->onURLEntryEditedByUser(editedUrl, result);
+    // matches are delivered with historyItemsByKeywordsFound signal
+    m_historyService->searchHistoryItemsByKeywordsString(editedUrl,
+            historyItemsVisibleMax, minKeywordLength, true);
 }
 
 void SimpleUI::showFindOnPageUI(const std::string& str)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    M_ASSERT(m_findOnPageUI);
-    m_findOnPageUI->show();
-    m_findOnPageUI->set_text(str.c_str());
+    auto findOnPageUI = getFindOnPageUI();
+    findOnPageUI->show();
+    findOnPageUI->set_text(str.c_str());
 }
 
 void SimpleUI::findWord(const struct FindData& fdata)
@@ -1553,7 +1642,6 @@ void SimpleUI::findWord(const struct FindData& fdata)
 void SimpleUI::closeFindOnPageUI()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    M_ASSERT(m_findOnPageUI);
     if (m_findOnPageUI)
         m_findOnPageUI->hideUI();
 }
@@ -1561,12 +1649,14 @@ void SimpleUI::closeFindOnPageUI()
 void SimpleUI::showTabUI()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    pushViewToStack(m_tabUI);
-
+    // requested before the page is covered, tab manager is refreshed with
+    // the snapshot, when it is ready
     if (!m_webPageUI->stateEquals(WPUState::QUICK_ACCESS) &&
         m_webEngine->tabsCount() > 0 &&
         m_webEngine->isLoading())
         onGenerateThumb(m_webEngine->currentTabId());
+
+    pushViewToStack(m_tabUI);
 }
 
 void SimpleUI::refetchTabUIData() {
@@ -1746,18 +1836,15 @@ void SimpleUI::certPopupButtonClicked(PopupButtons button, std::shared_ptr<Popup
 Evas_Object* SimpleUI::showHistoryUI(Evas_Object* parent, SharedNaviframeWrapper naviframe, bool removeMode)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    m_historyUI->setNaviframe(naviframe);
-    auto ret = m_historyUI->createDaysList(parent, removeMode);
-    m_historyUI->addHistoryItems(
-        m_historyService->getHistoryToday(), HistoryPeriod::HISTORY_TODAY);
-    m_historyUI->addHistoryItems(
-        m_historyService->getHistoryYesterday(), HistoryPeriod::HISTORY_YESTERDAY);
-    m_historyUI->addHistoryItems(
-        m_historyService->getHistoryLastWeek(), HistoryPeriod::HISTORY_LASTWEEK);
-    m_historyUI->addHistoryItems(
-        m_historyService->getHistoryLastMonth(), HistoryPeriod::HISTORY_LASTMONTH);
-    m_historyUI->addHistoryItems(
-        m_historyService->getHistoryOlder(), HistoryPeriod::HISTORY_OLDER);
+    auto historyUI = getHistoryUI();
+    historyUI->setNaviframe(naviframe);
+    auto ret = historyUI->createDaysList(parent, removeMode);
+    // only the first page of each period, next ones are loaded on scrolling
+    onHistoryPageRequested(HistoryPeriod::HISTORY_TODAY, 0);
+    onHistoryPageRequested(HistoryPeriod::HISTORY_YESTERDAY, 0);
+    onHistoryPageRequested(HistoryPeriod::HISTORY_LASTWEEK, 0);
+    onHistoryPageRequested(HistoryPeriod::HISTORY_LASTMONTH, 0);
+    onHistoryPageRequested(HistoryPeriod::HISTORY_OLDER, 0);
     return ret;
 }
 
@@ -58,6 +58,7 @@ class CertificateContents;
 namespace base_ui{
 class WebPageUI;
 class HistoryUI;
+enum class HistoryPeriod;
 class FindOnPageUI;
 class SettingsUI;
 class SettingsManager;
@@ -113,6 +114,9 @@ private:
     void loadModelServices();
     void initModelServices();
     void initUIServices();
+    /// HistoryUI and FindOnPageUI are rarely used, they are loaded on first use
+    std::shared_ptr<HistoryUI> getHistoryUI();
+    std::shared_ptr<FindOnPageUI> getFindOnPageUI();
     void connectModelSignals();
     void pushViewToStack(const sAUI& view);
     void popTheStack();
@@ -183,6 +187,7 @@ private:
     void openURL(const std::string& url, const std::string& title, bool desktopMode);
     void onClearHistoryAllClicked();
     void onDeleteHistoryItems(int id);
+    void onHistoryPageRequested(HistoryPeriod period, int offset);
 
     void onMostVisitedClicked();
     void onQuickAccessClicked();
@@ -192,7 +197,9 @@ private:
      */
     void onGenerateThumb(basic_webengine::TabId tabId);
     void onGenerateFavicon(basic_webengine::TabId tabId);
-    void onSnapshotCaptured(std::shared_ptr<tools::BrowserImage> snapshot, tools::SnapshotType snapshot_type);
+    void onSnapshotCaptured(std::shared_ptr<tools::BrowserImage> snapshot, tools::SnapshotType snapshot_type,
+        const basic_webengine::TabId& tabId, const std::string& uri);
+    void onTabDiscarded(basic_webengine::TabContentPtr tab);
     void onCreateTabId();
 
     void authPopupButtonClicked(PopupButtons button, std::shared_ptr<PopupData> popupData);
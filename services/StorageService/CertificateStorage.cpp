@@ -16,7 +16,6 @@
  *
  */
 
-#include <boost/format.hpp>
 #include <BrowserAssert.h>
 #include <string>
 #include "Config.h"
@@ -46,6 +45,14 @@ namespace {
                             + "      ON CONFLICT REPLACE "
                             + " ); ";
 
+    const std::string SQL_GET_CERTIFICATES = "SELECT " + COL_HOST + ", " + COL_ALLOW
+                            + " FROM " + TABLE_CERTIFICATE + " ;";
+    const std::string SQL_GET_CERTIFICATES_COUNT = "SELECT COUNT (*) FROM " + TABLE_CERTIFICATE + " ;";
+    const std::string SQL_ADD_CERTIFICATE = "REPLACE INTO " + TABLE_CERTIFICATE
+                            + " ( " + COL_HOST + ", " + COL_PEM + ", " + COL_ALLOW + " ) VALUES ( ?, ?, ? );";
+    const std::string SQL_GET_PEM = "SELECT " + COL_PEM + " FROM " + TABLE_CERTIFICATE
+                            + " WHERE " + COL_HOST + " = ?;";
+    const std::string SQL_DELETE_CERTIFICATES = "DELETE FROM " + TABLE_CERTIFICATE + ";";
 }
 
 namespace tizen_browser {
@@ -110,12 +117,10 @@ std::shared_ptr<HostCertList> CertificateStorage::getHostCertList()
     int itemsCount = getCertificateEntriesCount();
     BROWSER_LOGD("Items count = %d", itemsCount);
     if (itemsCount != 0) {
-        boost::format getCertificateString("SELECT %1%, %2% FROM %3% ;");
-        getCertificateString % COL_HOST % COL_ALLOW % TABLE_CERTIFICATE;
         try {
-            storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE));
+            storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE), storage::TransactionMode::Read);
             std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-            storage::SQLQuery getCertificateQuery(connection->prepare(getCertificateString.str()));
+            storage::SQLQuery getCertificateQuery(connection->prepare(SQL_GET_CERTIFICATES));
             getCertificateQuery.exec();
             for (int i = 0; i < itemsCount; ++i) {
                 std::pair<std::string, int> hostCert = std::make_pair<std::string, int>(
@@ -133,12 +138,10 @@ std::shared_ptr<HostCertList> CertificateStorage::getHostCertList()
 unsigned int CertificateStorage::getCertificateEntriesCount()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getCountString("SELECT COUNT (*) FROM %1% ;");
-    getCountString % TABLE_CERTIFICATE;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-        storage::SQLQuery getCountQuery(connection->prepare(getCountString.str()));
+        storage::SQLQuery getCountQuery(connection->prepare(SQL_GET_CERTIFICATES_COUNT));
         getCountQuery.exec();
         return getCountQuery.getInt(0);
     } catch (storage::StorageException& e) {
@@ -150,12 +153,10 @@ unsigned int CertificateStorage::getCertificateEntriesCount()
 unsigned int CertificateStorage::addOrUpdateCertificateEntry(const std::string& pem, const std::string& host, int allow)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format addCertificateQueryString("REPLACE INTO %1% ( %2%, %3%, %4% ) VALUES ( ?, ?, ? );");
-    addCertificateQueryString % TABLE_CERTIFICATE % COL_HOST % COL_PEM % COL_ALLOW;
     try {
         storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE));
         std::shared_ptr<storage::SQLDatabase> db = scope.database();
-        storage::SQLQuery addCertificateQuery(db->prepare(addCertificateQueryString.str()));
+        storage::SQLQuery addCertificateQuery(db->prepare(SQL_ADD_CERTIFICATE));
         addCertificateQuery.bindText(1, host);
         addCertificateQuery.bindText(2, pem);
         addCertificateQuery.bindInt(3, allow);
@@ -170,12 +171,10 @@ unsigned int CertificateStorage::addOrUpdateCertificateEntry(const std::string&
 std::string CertificateStorage::getPemForURI(const std::string& uri)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getPemString("SELECT %1% FROM %2% WHERE %3% = ?;");
-    getPemString % COL_PEM % TABLE_CERTIFICATE % COL_HOST;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-        storage::SQLQuery getPemQuery(connection->prepare(getPemString.str()));
+        storage::SQLQuery getPemQuery(connection->prepare(SQL_GET_PEM));
         getPemQuery.bindText(1, uri);
         getPemQuery.exec();
 
@@ -189,13 +188,11 @@ std::string CertificateStorage::getPemForURI(const std::string& uri)
 void CertificateStorage::deleteAllEntries()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format deleteCertificateString("DELETE FROM %1%;");
-    deleteCertificateString % TABLE_CERTIFICATE;
     try {
         storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_CERTIFICATE));
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
 
-        storage::SQLQuery deleteCertificatesQuery(connection->prepare(deleteCertificateString.str()));
+        storage::SQLQuery deleteCertificatesQuery(connection->prepare(SQL_DELETE_CERTIFICATES));
         deleteCertificatesQuery.exec();
     } catch( storage::StorageException &e) {
         BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
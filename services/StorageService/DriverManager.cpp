@@ -16,6 +16,9 @@
 
 #include <memory>
 #include <map>
+#include <mutex>
+#include <vector>
+#include <Eina.h>
 #include <BrowserAssert.h>
 
 #include "DriverManager.h"
@@ -23,25 +26,93 @@
 namespace tizen_browser {
 namespace storage {
 
+// idle connections kept open for threads other than the main loop
+#define SQL_CONNECTION_POOL_SIZE    2
+
+struct DatabasePool
+{
+	std::string path;
+	// connection used by the main loop, never given to other threads
+	std::shared_ptr<SQLDatabase> main;
+	// connections returned by other threads, ready for reuse
+	std::vector< std::shared_ptr<SQLDatabase> > idle;
+	std::mutex mutex;
+};
+
 class DriverManagerInstance
 {
 public:
-	std::map< std::string, std::shared_ptr<SQLDatabase> > _instances;
+	std::mutex _mutex;
+	std::map< std::string, std::shared_ptr<DatabasePool> > _pools;
 
 	std::shared_ptr<SQLDatabase> getDatabase(const std::string& aConn);
+
+private:
+	std::shared_ptr<DatabasePool> getPool(const std::string& aConn);
+	static std::shared_ptr<SQLDatabase> acquire(std::shared_ptr<DatabasePool> pool);
+	static void release(std::weak_ptr<DatabasePool> pool, std::shared_ptr<SQLDatabase> db);
 };
 
 static DriverManagerInstance s_driverManager;
 
+std::shared_ptr<DatabasePool> DriverManagerInstance::getPool(const std::string& aConn)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::shared_ptr<DatabasePool>& pool = _pools[aConn];
+	if(!pool) {
+		pool = std::make_shared<DatabasePool>();
+		pool->path = aConn;
+	}
+	return pool;
+}
+
 std::shared_ptr<SQLDatabase> DriverManagerInstance::getDatabase(const std::string& aConn)
 {
-	auto it = _instances.find(aConn);
-	if(it != _instances.end())
-		return it->second;
-	std::shared_ptr<SQLDatabase> db(SQLDatabase::newInstance());
-	db->open(aConn);
-	_instances[aConn] = db;
-	return db;
+	std::shared_ptr<DatabasePool> pool(getPool(aConn));
+	if(!eina_main_loop_is())
+		return acquire(pool);
+
+	std::lock_guard<std::mutex> lock(pool->mutex);
+	if(!pool->main) {
+		std::shared_ptr<SQLDatabase> db(SQLDatabase::newInstance());
+		db->open(aConn);
+		pool->main = db;
+	}
+	return pool->main;
+}
+
+std::shared_ptr<SQLDatabase> DriverManagerInstance::acquire(std::shared_ptr<DatabasePool> pool)
+{
+	std::shared_ptr<SQLDatabase> db;
+	{
+		std::lock_guard<std::mutex> lock(pool->mutex);
+		if(!pool->idle.empty()) {
+			db = pool->idle.back();
+			pool->idle.pop_back();
+		} else if(pool->main) {
+			db = pool->main->cloneForThread();
+		}
+	}
+	if(!db) {
+		db = SQLDatabase::newInstance();
+		db->open(pool->path);
+	}
+
+	// connection goes back to the pool, when the last user releases it
+	std::weak_ptr<DatabasePool> weakPool(pool);
+	return std::shared_ptr<SQLDatabase>(db.get(), [weakPool, db](SQLDatabase *) {
+		release(weakPool, db);
+	});
+}
+
+void DriverManagerInstance::release(std::weak_ptr<DatabasePool> weakPool, std::shared_ptr<SQLDatabase> db)
+{
+	std::shared_ptr<DatabasePool> pool(weakPool.lock());
+	if(!pool)
+		return;
+	std::lock_guard<std::mutex> lock(pool->mutex);
+	if(pool->idle.size() < SQL_CONNECTION_POOL_SIZE)
+		pool->idle.push_back(db);
 }
 
 DriverManager::DriverManager()
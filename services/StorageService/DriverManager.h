@@ -29,6 +29,14 @@ class DriverManager
 public:
     DriverManager();
     ~DriverManager();
+    /**
+     * @brief Get connection to database.
+     *
+     * The main loop always gets the same connection. Other threads get
+     * a connection from a small pool, which is returned to the pool when
+     * the last copy of returned pointer is released, so it should not be
+     * kept longer than needed nor passed to another thread.
+     */
     static std::shared_ptr<SQLDatabase> getDatabase(const std::string & aConn);
 };
 
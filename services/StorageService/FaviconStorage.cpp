@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <boost/any.hpp>
+
+#include "BrowserLogger.h"
+#include "Config.h"
+#include "DBTools.h"
+#include "DriverManager.h"
+#include "EflTools.h"
+#include "GeneralTools.h"
+#include "SQLTransactionScope.h"
+#include "StorageException.h"
+
+#include "FaviconStorage.h"
+
+namespace {
+// ------ Database FAVICON ------
+const std::string TABLE_FAVICONS = "FAVICONS";
+const std::string TABLE_FAVICON_HOSTS = "FAVICON_HOSTS";
+const std::string COL_HASH = "HASH";
+const std::string COL_WIDTH = "WIDTH";
+const std::string COL_HEIGHT = "HEIGHT";
+const std::string COL_DATA = "DATA";
+const std::string COL_HOST = "HOST";
+const std::string COL_PINS = "PINS";
+
+const std::string CREATE_TABLE_FAVICONS
+        = "CREATE TABLE " + TABLE_FAVICONS
+        +   " ( " + COL_HASH + " INTEGER PRIMARY KEY, "
+        +   COL_WIDTH + " INTEGER, "
+        +   COL_HEIGHT + " INTEGER, "
+        +   COL_DATA + " BLOB "
+        + " );";
+
+const std::string CREATE_TABLE_FAVICON_HOSTS
+        = "CREATE TABLE " + TABLE_FAVICON_HOSTS
+        +   " ( " + COL_HOST + " TEXT PRIMARY KEY, "
+        +   COL_HASH + " INTEGER NOT NULL, "
+        +   COL_PINS + " INTEGER NOT NULL DEFAULT 0 "
+        + " );";
+
+const std::string SQL_GET_HOST_HASH
+        = "SELECT " + COL_HASH + " FROM " + TABLE_FAVICON_HOSTS + " WHERE " + COL_HOST + " = ?;";
+
+const std::string SQL_GET_FAVICON
+        = "SELECT " + COL_WIDTH + ", " + COL_HEIGHT + ", " + COL_DATA
+        + " FROM " + TABLE_FAVICONS + " WHERE " + COL_HASH + " = ?;";
+
+const std::string SQL_ADD_FAVICON
+        = "INSERT OR IGNORE INTO " + TABLE_FAVICONS
+        +   " (" + COL_HASH + ", " + COL_WIDTH + ", " + COL_HEIGHT + ", " + COL_DATA + ") "
+        + "VALUES (?, ?, ?, ?);";
+
+// host without favicon is added with hash 0, when it is pinned first
+const std::string SQL_ADD_HOST
+        = "INSERT OR IGNORE INTO " + TABLE_FAVICON_HOSTS
+        +   " (" + COL_HOST + ", " + COL_HASH + ") VALUES (?, 0);";
+
+const std::string SQL_SET_HOST_HASH
+        = "UPDATE " + TABLE_FAVICON_HOSTS + " SET " + COL_HASH + " = ? WHERE " + COL_HOST + " = ?;";
+
+const std::string SQL_PIN_HOST
+        = "UPDATE " + TABLE_FAVICON_HOSTS + " SET " + COL_PINS + " = MAX(" + COL_PINS + " + ?, 0)"
+        + " WHERE " + COL_HOST + " = ?;";
+
+const std::string SQL_DELETE_UNPINNED_HOSTS
+        = "DELETE FROM " + TABLE_FAVICON_HOSTS + " WHERE " + COL_PINS + " = 0;";
+
+const std::string SQL_DELETE_UNUSED_FAVICON
+        = "DELETE FROM " + TABLE_FAVICONS + " WHERE " + COL_HASH + " = ? AND " + COL_HASH
+        + " NOT IN (SELECT " + COL_HASH + " FROM " + TABLE_FAVICON_HOSTS + ");";
+
+const std::string SQL_DELETE_UNUSED_FAVICONS
+        = "DELETE FROM " + TABLE_FAVICONS + " WHERE " + COL_HASH
+        + " NOT IN (SELECT " + COL_HASH + " FROM " + TABLE_FAVICON_HOSTS + ");";
+// ------ (end) Database FAVICON ------
+
+// FNV-1a of encoded favicon, equal images of different hosts get the same hash
+long long contentHash(const void* data, std::size_t length)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < length; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<long long>(hash);
+}
+}
+
+namespace tizen_browser {
+namespace storage {
+
+FaviconStorage::FaviconStorage()
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    init();
+}
+
+void FaviconStorage::init()
+{
+    std::string resourceDbDir(boost::any_cast<std::string> (config::Config::getInstance().get("resourcedb/dir")));
+    std::string faviconDb(boost::any_cast<std::string> (config::Config::getInstance().get("DB_FAVICON")));
+    DB_FAVICON = resourceDbDir + faviconDb;
+    BROWSER_LOGD("[%s:%d] DB_FAVICON=%s", __PRETTY_FUNCTION__, __LINE__, DB_FAVICON.c_str());
+    try {
+        dbtools::checkAndCreateTable(DB_FAVICON, TABLE_FAVICONS, CREATE_TABLE_FAVICONS);
+        dbtools::checkAndCreateTable(DB_FAVICON, TABLE_FAVICON_HOSTS, CREATE_TABLE_FAVICON_HOSTS);
+    } catch (storage::StorageException &e) {
+        BROWSER_LOGE("[%s:%d] Cannot initialize database %s!", __PRETTY_FUNCTION__, __LINE__, DB_FAVICON.c_str());
+    }
+}
+
+void FaviconStorage::setFavicon(const std::string& url, tools::BrowserImagePtr favicon)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    std::unique_ptr<tools::Blob> blob = tools::EflTools::getBlob(favicon);
+    if (!blob) {
+        BROWSER_LOGW("[%s:%d] getBlob failed", __PRETTY_FUNCTION__, __LINE__);
+        return;
+    }
+    const Hash hash = contentHash(blob->getData(), blob->getLength());
+    const std::string host(tools::extractDomain(url));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Hash previous = hostHash(host);
+    if (previous == hash)
+        return;
+    try {
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FAVICON));
+        std::shared_ptr<storage::SQLDatabase> db = scope.database();
+        storage::SQLQuery addFaviconQuery(db->prepare(SQL_ADD_FAVICON));
+        addFaviconQuery.bindInt64(1, hash);
+        addFaviconQuery.bindInt(2, favicon->getWidth());
+        addFaviconQuery.bindInt(3, favicon->getHeight());
+        addFaviconQuery.bindBlob(4, blob->getData(), blob->getLength());
+        addFaviconQuery.exec();
+
+        storage::SQLQuery addHostQuery(db->prepare(SQL_ADD_HOST));
+        addHostQuery.bindText(1, host);
+        addHostQuery.exec();
+
+        storage::SQLQuery setHostHashQuery(db->prepare(SQL_SET_HOST_HASH));
+        setHostHashQuery.bindInt64(1, hash);
+        setHostHashQuery.bindText(2, host);
+        setHostHashQuery.exec();
+
+        if (previous != 0) {
+            storage::SQLQuery deleteFaviconQuery(db->prepare(SQL_DELETE_UNUSED_FAVICON));
+            deleteFaviconQuery.bindInt64(1, previous);
+            deleteFaviconQuery.exec();
+        }
+    } catch (storage::StorageException &e) {
+        BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+        return;
+    }
+    m_hosts[host] = hash;
+    m_favicons.erase(previous);
+
+    // encoded data is kept, so the favicon is not read back from the database
+    auto image = std::make_shared<tools::BrowserImage>(favicon->getWidth(), favicon->getHeight(), blob->getLength());
+    void* data = nullptr;
+    blob->transferData(&data);
+    image->takeData(data, tools::ImageType::ImageTypePNG);
+    m_favicons[hash] = image;
+}
+
+tools::BrowserImagePtr FaviconStorage::getFavicon(const std::string& url)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Hash hash = hostHash(tools::extractDomain(url));
+    if (hash == 0)
+        return nullptr;
+    auto cached = m_favicons.find(hash);
+    if (cached != m_favicons.end())
+        return cached->second;
+    auto favicon = loadFavicon(hash);
+    if (favicon)
+        m_favicons[hash] = favicon;
+    return favicon;
+}
+
+void FaviconStorage::pin(const std::string& url)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    const std::string host(tools::extractDomain(url));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    try {
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FAVICON));
+        std::shared_ptr<storage::SQLDatabase> db = scope.database();
+        storage::SQLQuery addHostQuery(db->prepare(SQL_ADD_HOST));
+        addHostQuery.bindText(1, host);
+        addHostQuery.exec();
+
+        storage::SQLQuery pinHostQuery(db->prepare(SQL_PIN_HOST));
+        pinHostQuery.bindInt(1, 1);
+        pinHostQuery.bindText(2, host);
+        pinHostQuery.exec();
+    } catch (storage::StorageException &e) {
+        BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+    }
+}
+
+void FaviconStorage::unpin(const std::string& url)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    const std::string host(tools::extractDomain(url));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    try {
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FAVICON));
+        std::shared_ptr<storage::SQLDatabase> db = scope.database();
+        storage::SQLQuery unpinHostQuery(db->prepare(SQL_PIN_HOST));
+        unpinHostQuery.bindInt(1, -1);
+        unpinHostQuery.bindText(2, host);
+        unpinHostQuery.exec();
+    } catch (storage::StorageException &e) {
+        BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+    }
+}
+
+void FaviconStorage::clear()
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    try {
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FAVICON));
+        std::shared_ptr<storage::SQLDatabase> db = scope.database();
+        storage::SQLQuery deleteHostsQuery(db->prepare(SQL_DELETE_UNPINNED_HOSTS));
+        deleteHostsQuery.exec();
+
+        storage::SQLQuery deleteFaviconsQuery(db->prepare(SQL_DELETE_UNUSED_FAVICONS));
+        deleteFaviconsQuery.exec();
+    } catch (storage::StorageException &e) {
+        BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+    }
+    // pinned hosts are read again, when requested
+    m_hosts.clear();
+    m_favicons.clear();
+}
+
+FaviconStorage::Hash FaviconStorage::hostHash(const std::string& host)
+{
+    auto cached = m_hosts.find(host);
+    if (cached != m_hosts.end())
+        return cached->second;
+
+    Hash hash = 0;
+    try {
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FAVICON), storage::TransactionMode::Read);
+        std::shared_ptr<storage::SQLDatabase> db = scope.database();
+        storage::SQLQuery getHostHashQuery(db->prepare(SQL_GET_HOST_HASH));
+        getHostHashQuery.bindText(1, host);
+        getHostHashQuery.exec();
+        if (getHostHashQuery.hasNext())
+            hash = getHostHashQuery.getInt64(0);
+    } catch (storage::StorageException &e) {
+        BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+        return 0;
+    }
+    m_hosts[host] = hash;
+    return hash;
+}
+
+tools::BrowserImagePtr FaviconStorage::loadFavicon(Hash hash)
+{
+    try {
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FAVICON), storage::TransactionMode::Read);
+        std::shared_ptr<storage::SQLDatabase> db = scope.database();
+        storage::SQLQuery getFaviconQuery(db->prepare(SQL_GET_FAVICON));
+        getFaviconQuery.bindInt64(1, hash);
+        getFaviconQuery.exec();
+        if (!getFaviconQuery.hasNext())
+            return nullptr;
+        std::shared_ptr<tools::Blob> blob = getFaviconQuery.getBlob(2);
+        if (!blob || blob->getLength() <= 0)
+            return nullptr;
+        auto favicon = std::make_shared<tools::BrowserImage>(
+            getFaviconQuery.getInt(0),
+            getFaviconQuery.getInt(1),
+            blob->getLength());
+        void* data = nullptr;
+        blob->transferData(&data);
+        favicon->takeData(data, tools::ImageType::ImageTypePNG);
+        return favicon;
+    } catch (storage::StorageException &e) {
+        BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+    }
+    return nullptr;
+}
+
+}//end namespace storage
+}//end namespace tizen_browser
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FAVICONSTORAGE_H
+#define FAVICONSTORAGE_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "BrowserImage.h"
+
+namespace tizen_browser {
+namespace storage {
+
+/**
+ * @brief Favicons shared by history, tabs and quick access.
+ *
+ * Every favicon is stored once, under hash of its encoded data. Hosts refer
+ * to favicons by the hash, so a site visited many times or opened in many
+ * tabs keeps a single copy. Favicons read from the database are kept in
+ * memory, each one is shared by all items of its host.
+ *
+ * Store is used from services' constructors and from background threads,
+ * so it is a singleton guarded by a mutex rather than a service.
+ */
+class FaviconStorage
+{
+public:
+    static FaviconStorage& getInstance()
+    {
+        static FaviconStorage instance;
+        return instance;
+    }
+    FaviconStorage(FaviconStorage const&) = delete;
+    void operator=(FaviconStorage const&) = delete;
+
+    /**
+     * @brief Sets favicon of the url's host. Raw images are encoded to PNG,
+     * nothing is written when the host already has the same favicon.
+     */
+    void setFavicon(const std::string& url, tools::BrowserImagePtr favicon);
+
+    /**
+     * @return favicon of the url's host or nullptr, when there is none
+     */
+    tools::BrowserImagePtr getFavicon(const std::string& url);
+
+    /**
+     * @brief Pinned hosts keep their favicons, when history is cleared.
+     * Pins are counted, each pin() should be matched by unpin().
+     */
+    void pin(const std::string& url);
+    void unpin(const std::string& url);
+
+    /**
+     * @brief Removes favicons of all hosts, which are not pinned.
+     */
+    void clear();
+
+private:
+    using Hash = long long;
+
+    FaviconStorage();
+    void init();
+    Hash hostHash(const std::string& host);
+    tools::BrowserImagePtr loadFavicon(Hash hash);
+
+    std::string DB_FAVICON;
+    std::mutex m_mutex;
+    // host -> favicon hash, 0 when host has no favicon
+    std::unordered_map<std::string, Hash> m_hosts;
+    std::unordered_map<Hash, tools::BrowserImagePtr> m_favicons;
+};
+
+}//end namespace storage
+}//end namespace tizen_browser
+
+#endif // FAVICONSTORAGE_H
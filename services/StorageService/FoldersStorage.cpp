@@ -23,7 +23,6 @@
  *      Author: m.kawonczyk@samsung.com
  */
 
-#include <boost/format.hpp>
 #include <BrowserAssert.h>
 #include <string>
 #include "Config.h"
@@ -53,6 +52,30 @@ namespace {
                             + "      ON CONFLICT REPLACE "
                             + " ); ";
 
+    const std::string SQL_GET_FOLDERS = "SELECT " + COL_FOLDER_ID + ", " + COL_FOLDER_NAME + ", "
+                            + COL_FOLDER_NUMBER + " FROM " + TABLE_FOLDER + " ;";
+    const std::string SQL_GET_FOLDERS_COUNT = "SELECT COUNT (*) FROM " + TABLE_FOLDER + " ;";
+    const std::string SQL_ADD_FOLDER = "INSERT OR REPLACE INTO " + TABLE_FOLDER
+                            + " ( " + COL_FOLDER_NAME + " ) VALUES ( ? );";
+    const std::string SQL_UPDATE_FOLDER_NAME = "UPDATE " + TABLE_FOLDER + " SET "
+                            + COL_FOLDER_NAME + " = ? WHERE " + COL_FOLDER_ID + " = ?";
+    const std::string SQL_UPDATE_FOLDER_NUMBER = "UPDATE " + TABLE_FOLDER + " SET "
+                            + COL_FOLDER_NUMBER + " = ? WHERE " + COL_FOLDER_ID + " = ?";
+    const std::string SQL_DELETE_FOLDERS_EXCEPT = "DELETE FROM " + TABLE_FOLDER + " WHERE "
+                            + COL_FOLDER_ID + " != ? AND " + COL_FOLDER_ID + " != ? ;";
+    const std::string SQL_UPDATE_FOLDERS_NUMBER = "UPDATE " + TABLE_FOLDER + " SET "
+                            + COL_FOLDER_NUMBER + " = ? WHERE " + COL_FOLDER_ID + " = ? OR "
+                            + COL_FOLDER_ID + " = ?";
+    const std::string SQL_DELETE_FOLDER = "DELETE FROM " + TABLE_FOLDER + " WHERE "
+                            + COL_FOLDER_ID + " = ?;";
+    const std::string SQL_GET_FOLDER_NAME_COUNT = "SELECT COUNT (*) FROM " + TABLE_FOLDER
+                            + " WHERE " + COL_FOLDER_NAME + " = ?;";
+    const std::string SQL_GET_FOLDER_ID = "SELECT " + COL_FOLDER_ID + " FROM " + TABLE_FOLDER
+                            + " WHERE " + COL_FOLDER_NAME + " = ?;";
+    const std::string SQL_GET_FOLDER_NAME = "SELECT " + COL_FOLDER_NAME + " FROM " + TABLE_FOLDER
+                            + " WHERE " + COL_FOLDER_ID + " = ?;";
+    const std::string SQL_GET_FOLDER_NUMBER = "SELECT " + COL_FOLDER_NUMBER + " FROM " + TABLE_FOLDER
+                            + " WHERE " + COL_FOLDER_ID + " = ?;";
 }
 
 namespace tizen_browser {
@@ -142,12 +165,10 @@ services::SharedBookmarkFolderList FoldersStorage::getFolders()
     services::SharedBookmarkFolderList folders;
     int foldersCount = getFoldersCount();
     if (foldersCount != 0) {
-        boost::format getFoldersString("SELECT %1%, %2%, %3% FROM %4% ;");
-        getFoldersString % COL_FOLDER_ID % COL_FOLDER_NAME % COL_FOLDER_NUMBER % TABLE_FOLDER;
         try {
-            storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
+            storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS), storage::TransactionMode::Read);
             std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-            storage::SQLQuery getFoldersQuery(connection->prepare(getFoldersString.str()));
+            storage::SQLQuery getFoldersQuery(connection->prepare(SQL_GET_FOLDERS));
             getFoldersQuery.exec();
             for (int i = 0; i < foldersCount; ++i) {
                 services::SharedBookmarkFolder bookmark = std::make_shared<services::BookmarkFolder>(
@@ -165,12 +186,10 @@ services::SharedBookmarkFolderList FoldersStorage::getFolders()
 unsigned int FoldersStorage::getFoldersCount()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getCountString("SELECT COUNT (*) FROM %1% ;");
-    getCountString % TABLE_FOLDER;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-        storage::SQLQuery getCountQuery(connection->prepare(getCountString.str()));
+        storage::SQLQuery getCountQuery(connection->prepare(SQL_GET_FOLDERS_COUNT));
         getCountQuery.exec();
         return getCountQuery.getInt(0);
     } catch (storage::StorageException& e) {
@@ -182,12 +201,10 @@ unsigned int FoldersStorage::getFoldersCount()
 unsigned int FoldersStorage::addFolder(const std::string& name)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format addFolderQueryString("INSERT OR REPLACE INTO %1% ( %2% ) VALUES ( ? );");
-    addFolderQueryString % TABLE_FOLDER % COL_FOLDER_NAME;
     try {
         storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
         std::shared_ptr<storage::SQLDatabase> db = scope.database();
-        storage::SQLQuery addFolderQuery(db->prepare(addFolderQueryString.str()));
+        storage::SQLQuery addFolderQuery(db->prepare(SQL_ADD_FOLDER));
         addFolderQuery.bindText(1, name);
         addFolderQuery.exec();
         return db->lastInsertId();
@@ -202,12 +219,10 @@ void FoldersStorage::updateFolderName(unsigned int id, const std::string& newNam
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     if (id == AllFolder)
         return;
-    boost::format updateFolderNameString("UPDATE %1%  SET %2% = ? WHERE %3% = ?" );
-    updateFolderNameString % TABLE_FOLDER % COL_FOLDER_NAME % COL_FOLDER_ID;
     storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
     std::shared_ptr<storage::SQLDatabase> connection = scope.database();
     try {
-        storage::SQLQuery updateFolderNameQuery(connection->prepare(updateFolderNameString.str()));
+        storage::SQLQuery updateFolderNameQuery(connection->prepare(SQL_UPDATE_FOLDER_NAME));
         updateFolderNameQuery.bindText(1, newName);
         updateFolderNameQuery.bindInt(2, id);
         updateFolderNameQuery.exec();
@@ -221,13 +236,11 @@ void FoldersStorage::addNumberInFolder(unsigned int id)
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     if (id != AllFolder)
         addNumberInFolder(AllFolder);
-    boost::format updateFolderNameString("UPDATE %1% SET %2% = ? WHERE %3% = ?" );
-    updateFolderNameString % TABLE_FOLDER % COL_FOLDER_NUMBER % COL_FOLDER_ID;
     int count = getFolderNumber(id);
     storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
     std::shared_ptr<storage::SQLDatabase> connection = scope.database();
     try {
-        storage::SQLQuery updateFolderNameQuery(connection->prepare(updateFolderNameString.str()));
+        storage::SQLQuery updateFolderNameQuery(connection->prepare(SQL_UPDATE_FOLDER_NUMBER));
         updateFolderNameQuery.bindInt(1, count+1);
         updateFolderNameQuery.bindInt(2, id);
         updateFolderNameQuery.exec();
@@ -241,13 +254,11 @@ void FoldersStorage::removeNumberInFolder(unsigned int id)
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     if (id != AllFolder)
         removeNumberInFolder(AllFolder);
-    boost::format updateFolderNameString("UPDATE %1% SET %2% = ? WHERE %3% = ?" );
-    updateFolderNameString % TABLE_FOLDER % COL_FOLDER_NUMBER % COL_FOLDER_ID;
     int count = getFolderNumber(id);
     storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
     std::shared_ptr<storage::SQLDatabase> connection = scope.database();
     try {
-        storage::SQLQuery updateFolderNameQuery(connection->prepare(updateFolderNameString.str()));
+        storage::SQLQuery updateFolderNameQuery(connection->prepare(SQL_UPDATE_FOLDER_NUMBER));
         updateFolderNameQuery.bindInt(1, count-1);
         updateFolderNameQuery.bindInt(2, id);
         updateFolderNameQuery.exec();
@@ -259,13 +270,11 @@ void FoldersStorage::removeNumberInFolder(unsigned int id)
 void FoldersStorage::deleteAllFolders()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format deleteFoldersString("DELETE FROM %1% WHERE %2% != ? AND %3% != ? ;");
-    deleteFoldersString % TABLE_FOLDER % COL_FOLDER_ID % COL_FOLDER_ID;
     try {
         storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
 
-        storage::SQLQuery deleteFoldersQuery(connection->prepare(deleteFoldersString.str()));
+        storage::SQLQuery deleteFoldersQuery(connection->prepare(SQL_DELETE_FOLDERS_EXCEPT));
         deleteFoldersQuery.bindInt(1, AllFolder);
         deleteFoldersQuery.bindInt(2, SpecialFolder);
         deleteFoldersQuery.exec();
@@ -273,13 +282,11 @@ void FoldersStorage::deleteAllFolders()
         BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
     }
 
-    boost::format updateFoldersCountString("UPDATE %1% SET %2% = ? WHERE %3% = ? OR %4% = ?");
-    updateFoldersCountString % TABLE_FOLDER % COL_FOLDER_NUMBER % COL_FOLDER_ID % COL_FOLDER_ID;
     try {
         storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
 
-        storage::SQLQuery updateFoldersCountQuery(connection->prepare(updateFoldersCountString.str()));
+        storage::SQLQuery updateFoldersCountQuery(connection->prepare(SQL_UPDATE_FOLDERS_NUMBER));
         updateFoldersCountQuery.bindInt(1, 0);
         updateFoldersCountQuery.bindInt(2, AllFolder);
         updateFoldersCountQuery.bindInt(3, SpecialFolder);
@@ -294,13 +301,10 @@ void FoldersStorage::deleteFolder(unsigned int id)
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     if (id == AllFolder || id == SpecialFolder)
         return;
-    boost::format deleteFolderString("DELETE FROM %1% WHERE %2% = ?;");
-    deleteFolderString % TABLE_FOLDER % COL_FOLDER_ID;
-
     storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
     std::shared_ptr<storage::SQLDatabase> connection = scope.database();
     try {
-        storage::SQLQuery deleteFolderQurey(connection->prepare(deleteFolderString.str()));
+        storage::SQLQuery deleteFolderQurey(connection->prepare(SQL_DELETE_FOLDER));
         deleteFolderQurey.bindInt(1, id);
         deleteFolderQurey.exec();
     } catch (storage::StorageException &e) {
@@ -311,12 +315,10 @@ void FoldersStorage::deleteFolder(unsigned int id)
 bool FoldersStorage::ifFolderExists(const std::string& name)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getCountString("SELECT COUNT (*) FROM %1% WHERE %2% = ?;");
-    getCountString % TABLE_FOLDER % COL_FOLDER_NAME;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-        storage::SQLQuery getCountQuery(connection->prepare(getCountString.str()));
+        storage::SQLQuery getCountQuery(connection->prepare(SQL_GET_FOLDER_NAME_COUNT));
         getCountQuery.bindText(1, name);
         getCountQuery.exec();
         int number = getCountQuery.getInt(0);
@@ -330,12 +332,10 @@ bool FoldersStorage::ifFolderExists(const std::string& name)
 unsigned int FoldersStorage::getFolderId(const std::string& name)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getIdString("SELECT %1% FROM %2% WHERE %3% = ?;");
-    getIdString % COL_FOLDER_ID % TABLE_FOLDER % COL_FOLDER_NAME;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-        storage::SQLQuery getIdQuery(connection->prepare(getIdString.str()));
+        storage::SQLQuery getIdQuery(connection->prepare(SQL_GET_FOLDER_ID));
         getIdQuery.bindText(1, name);
         getIdQuery.exec();
         return getIdQuery.getInt(0);
@@ -348,12 +348,10 @@ unsigned int FoldersStorage::getFolderId(const std::string& name)
 std::string FoldersStorage::getFolderName(unsigned int id)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getNameString("SELECT %1% FROM %2% WHERE %3% = ?;");
-    getNameString % COL_FOLDER_NAME % TABLE_FOLDER % COL_FOLDER_ID;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-        storage::SQLQuery getNameQuery(connection->prepare(getNameString.str()));
+        storage::SQLQuery getNameQuery(connection->prepare(SQL_GET_FOLDER_NAME));
         getNameQuery.bindInt(1, id);
         getNameQuery.exec();
 
@@ -367,12 +365,10 @@ std::string FoldersStorage::getFolderName(unsigned int id)
 unsigned int FoldersStorage::getFolderNumber(unsigned int id)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getNameString("SELECT %1% FROM %2% WHERE %3% = ?;");
-    getNameString % COL_FOLDER_NUMBER % TABLE_FOLDER % COL_FOLDER_ID;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_FOLDERS), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> connection = scope.database();
-        storage::SQLQuery getNameQuery(connection->prepare(getNameString.str()));
+        storage::SQLQuery getNameQuery(connection->prepare(SQL_GET_FOLDER_NUMBER));
         getNameQuery.bindInt(1, id);
         getNameQuery.exec();
 
@@ -17,7 +17,6 @@
 #include <string>
 #include <BrowserAssert.h>
 #include <boost/any.hpp>
-#include <boost/format.hpp>
 #include "EflTools.h"
 
 #include "Field.h"
@@ -45,6 +44,18 @@ const std::string CREATE_TABLE_PWA
         +   COL_EXIST + " INTEGER, "
         +   COL_NEVER + " INTEGER "
         + " );";
+
+const std::string SQL_ADD_PWA_ITEM
+        = "INSERT OR REPLACE INTO " + TABLE_PWA
+        +   " (" + COL_URL + ", " + COL_EXIST + ", " + COL_NEVER + ") VALUES (?, ?, ?);";
+
+const std::string SQL_DELETE_PWA_ITEMS = "DELETE FROM " + TABLE_PWA + " ;";
+
+const std::string SQL_GET_PWA_COUNT = "SELECT COUNT (*) FROM " + TABLE_PWA + " ;";
+
+const std::string SQL_GET_PWA_ITEM
+        = "SELECT " + COL_EXIST + ", " + COL_NEVER + " FROM " + TABLE_PWA
+        +   " WHERE " + COL_URL + " = ?;";
 // ------ (end) Database PWA ------
 }
 
@@ -80,12 +91,10 @@ void PWAStorage::init()
 void PWAStorage::addPWAItem(const std::string & url, const int & exist, const int & never)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format addPWAItemQueryString("INSERT OR REPLACE INTO %1% (%2%, %3%, %4%) VALUES (?, ?, ?);");
-    addPWAItemQueryString % TABLE_PWA % COL_URL % COL_EXIST % COL_NEVER;
     try {
         SQLTransactionScope scope(DriverManager::getDatabase(DB_PWA));
         std::shared_ptr<SQLDatabase> db = scope.database();
-        SQLQuery addPWAItemQuery(db->prepare(addPWAItemQueryString.str()));
+        SQLQuery addPWAItemQuery(db->prepare(SQL_ADD_PWA_ITEM));
         addPWAItemQuery.bindText(1, url);
         addPWAItemQuery.bindInt(2, exist);
         addPWAItemQuery.bindInt(3, never);
@@ -98,12 +107,10 @@ void PWAStorage::addPWAItem(const std::string & url, const int & exist, const in
 void PWAStorage::deletePWAItems()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format deletePWAItemQueryString("DELETE FROM %1% ;");
-    deletePWAItemQueryString % TABLE_PWA;
     try {
         SQLTransactionScope scope(DriverManager::getDatabase(DB_PWA));
         std::shared_ptr<SQLDatabase> db = scope.database();
-        SQLQuery deletePWAItemQuery(db->prepare(deletePWAItemQueryString.str()));
+        SQLQuery deletePWAItemQuery(db->prepare(SQL_DELETE_PWA_ITEMS));
         deletePWAItemQuery.exec();
     } catch (const StorageException& e) {
         BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
@@ -113,11 +120,10 @@ void PWAStorage::deletePWAItems()
 unsigned int PWAStorage::getPWACount()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getCountString("SELECT COUNT (*) FROM " + TABLE_PWA + " ;");
     try {
-        SQLTransactionScope scope(DriverManager::getDatabase(DB_PWA));
+        SQLTransactionScope scope(DriverManager::getDatabase(DB_PWA), TransactionMode::Read);
         std::shared_ptr<SQLDatabase> db = scope.database();
-        SQLQuery getCountQuery(db->prepare(getCountString.str()));
+        SQLQuery getCountQuery(db->prepare(SQL_GET_PWA_COUNT));
         getCountQuery.exec();
         return getCountQuery.getInt(0);
     } catch (const StorageException& e) {
@@ -129,31 +135,23 @@ unsigned int PWAStorage::getPWACount()
 int PWAStorage::getPWACheck(const std::string & url)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    int pwaCount = getPWACount();
-
-    if (pwaCount) {
-        boost::format getPWAListString("SELECT %1%, %2%, %3% FROM %4% ;");
-        getPWAListString % COL_URL % COL_EXIST % COL_NEVER % TABLE_PWA;
-        try {
-            SQLTransactionScope scope(DriverManager::getDatabase(DB_PWA));
-            std::shared_ptr<SQLDatabase> db = scope.database();
-            SQLQuery getPWAListQuery(db->prepare(getPWAListString.str()));
-            getPWAListQuery.exec();
-
-            for (int i = 0; i < pwaCount; ++i) {
-                if (!strcmp(url.c_str(), getPWAListQuery.getString(0).c_str())) {
-                    if (getPWAListQuery.getInt(2))
-                        return getPWAListQuery.getInt(2);
-                    else
-                        return getPWAListQuery.getInt(1);
-                }
-                getPWAListQuery.next();
-            }
-        } catch (const StorageException& e) {
-            BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+    try {
+        SQLTransactionScope scope(DriverManager::getDatabase(DB_PWA), TransactionMode::Read);
+        std::shared_ptr<SQLDatabase> db = scope.database();
+        SQLQuery getPWAItemQuery(db->prepare(SQL_GET_PWA_ITEM));
+        getPWAItemQuery.bindText(1, url);
+        getPWAItemQuery.exec();
+
+        if (getPWAItemQuery.hasNext()) {
+            if (getPWAItemQuery.getInt(1))
+                return getPWAItemQuery.getInt(1);
+            else
+                return getPWAItemQuery.getInt(0);
         }
+    } catch (const StorageException& e) {
+        BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
     }
-    BROWSER_LOGD("[%s:%d] pwaCount is 0 or string not equal !", __PRETTY_FUNCTION__, __LINE__);
+    BROWSER_LOGD("[%s:%d] no PWA item for url !", __PRETTY_FUNCTION__, __LINE__);
     return 0;
 }
 
@@ -17,7 +17,6 @@
 #include <string>
 #include <BrowserAssert.h>
 #include <boost/any.hpp>
-#include <boost/format.hpp>
 #include "EflTools.h"
 
 #include "Field.h"
@@ -28,6 +27,7 @@
 #include "StorageExceptionInitialization.h"
 #include "SQLTransactionScope.h"
 #include "BrowserImage.h"
+#include "FaviconStorage.h"
 
 
 #include "QuickAccessStorage.h"
@@ -57,6 +57,28 @@ const std::string CREATE_TABLE_QUICKACCESS
         +   COL_WIDTH + " INTEGER, "
         +   COL_HEIGHT + " INTEGER "
         + " );";
+
+const std::string SQL_ADD_QUICKACCESS_ITEM
+        = "INSERT OR REPLACE INTO " + TABLE_QUICKACCESS
+        +   " (" + COL_URL + ", " + COL_TITLE + ", " + COL_COLOR + ", " + COL_ORDER + ", "
+        +   COL_HAS_FAVICON + ", " + COL_FAVICON + ", " + COL_WIDTH + ", " + COL_HEIGHT + ") "
+        + "VALUES (?, ?, ?, ?, ?, ?, ?, ?);";
+
+const std::string SQL_DELETE_QUICKACCESS_ITEM
+        = "DELETE FROM " + TABLE_QUICKACCESS + " WHERE " + COL_ID + " = ?;";
+
+const std::string SQL_GET_QUICKACCESS_ITEM_URL
+        = "SELECT " + COL_URL + " FROM " + TABLE_QUICKACCESS + " WHERE " + COL_ID + " = ?;";
+
+const std::string SQL_GET_QUICKACCESS_COUNT = "SELECT COUNT (*) FROM " + TABLE_QUICKACCESS + " ;";
+
+const std::string SQL_GET_QUICKACCESS_URL_COUNT
+        = "SELECT COUNT(*) FROM " + TABLE_QUICKACCESS + " WHERE " + COL_URL + " = ?;";
+
+const std::string SQL_GET_QUICKACCESS_LIST
+        = "SELECT " + COL_ID + ", " + COL_URL + ", " + COL_TITLE + ", " + COL_COLOR + ", "
+        +   COL_ORDER + ", " + COL_HAS_FAVICON + ", " + COL_FAVICON + ", " + COL_WIDTH + ", "
+        +   COL_HEIGHT + " FROM " + TABLE_QUICKACCESS + " ;";
 // ------ (end) Database QUICKACCESS ------
 }
 
@@ -101,39 +123,50 @@ void QuickAccessStorage::addQuickAccessItem(
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     int hasFaviconInt = hasFavicon ? 1 : 0; // Convert to int bacause of SQLite doesn't have bool type.
-    boost::format addQuickAccessItemQueryString(
-        "INSERT OR REPLACE INTO %1% (%2%, %3%, %4%, %5%, %6%, %7%, %8%, %9%) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?);");
-    addQuickAccessItemQueryString % TABLE_QUICKACCESS % COL_URL % COL_TITLE % COL_COLOR % COL_ORDER %
-        COL_HAS_FAVICON % COL_FAVICON % COL_WIDTH % COL_HEIGHT;
+    bool isNewItem = false;
     try {
         storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS));
         std::shared_ptr<storage::SQLDatabase> db = scope.database();
-        storage::SQLQuery addQuickAccessItemQuery(db->prepare(addQuickAccessItemQueryString.str()));
+        // replaced item is pinned already, unpin is done once per item
+        storage::SQLQuery isItemExistQuery(db->prepare(SQL_GET_QUICKACCESS_URL_COUNT));
+        isItemExistQuery.bindText(1, url);
+        isItemExistQuery.exec();
+        isNewItem = !isItemExistQuery.getInt(0);
+
+        storage::SQLQuery addQuickAccessItemQuery(db->prepare(SQL_ADD_QUICKACCESS_ITEM));
         addQuickAccessItemQuery.bindText(1, url);
         addQuickAccessItemQuery.bindText(2, title);
         addQuickAccessItemQuery.bindInt(3, color);
         addQuickAccessItemQuery.bindInt(4, order);
         addQuickAccessItemQuery.bindInt(5, hasFaviconInt);
-        if (hasFavicon)
-            addQuickAccessItemQuery.bindBlob(6, tools::EflTools::getBlobPNG(favicon));
+        // favicon is kept in the favicon store, items added before it have it in FAVICON column
         addQuickAccessItemQuery.bindInt(7, width);
         addQuickAccessItemQuery.bindInt(8, height);
         addQuickAccessItemQuery.exec();
     } catch (storage::StorageException &e) {
         BROWSER_LOGD("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+        return;
     }
+    // host of quick access item keeps its favicon, when history is cleared
+    if (hasFavicon)
+        FaviconStorage::getInstance().setFavicon(url, favicon);
+    if (isNewItem)
+        FaviconStorage::getInstance().pin(url);
 }
 
 void QuickAccessStorage::deleteQuickAccessItem(unsigned int id)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format deleteQuickAccessItemQueryString("DELETE FROM %1% WHERE %2% = ?;");
-    deleteQuickAccessItemQueryString % TABLE_QUICKACCESS % COL_ID;
     try {
         storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS));
         std::shared_ptr<storage::SQLDatabase> db = scope.database();
-        storage::SQLQuery deleteQuickAccessItemQuery(db->prepare(deleteQuickAccessItemQueryString.str()));
+        storage::SQLQuery getUrlQuery(db->prepare(SQL_GET_QUICKACCESS_ITEM_URL));
+        getUrlQuery.bindInt(1, id);
+        getUrlQuery.exec();
+        if (getUrlQuery.hasNext())
+            FaviconStorage::getInstance().unpin(getUrlQuery.getString(0));
+
+        storage::SQLQuery deleteQuickAccessItemQuery(db->prepare(SQL_DELETE_QUICKACCESS_ITEM));
         deleteQuickAccessItemQuery.bindInt(1, id);
         deleteQuickAccessItemQuery.exec();
     } catch (storage::StorageException &e) {
@@ -144,11 +177,10 @@ void QuickAccessStorage::deleteQuickAccessItem(unsigned int id)
 unsigned int QuickAccessStorage::getQuickAccessCount()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format getCountString("SELECT COUNT (*) FROM " + TABLE_QUICKACCESS + " ;");
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> db = scope.database();
-        storage::SQLQuery getCountQuery(db->prepare(getCountString.str()));
+        storage::SQLQuery getCountQuery(db->prepare(SQL_GET_QUICKACCESS_COUNT));
         getCountQuery.exec();
         return getCountQuery.getInt(0);
     } catch (storage::StorageException &e) {
@@ -160,12 +192,10 @@ unsigned int QuickAccessStorage::getQuickAccessCount()
 bool QuickAccessStorage::quickAccessItemExist(const std::string &url)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    boost::format isItemExistString("SELECT COUNT(*) FROM %1% WHERE %2% = ?;");
-    isItemExistString % TABLE_QUICKACCESS % COL_URL;
     try {
-        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS));
+        storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS), storage::TransactionMode::Read);
         std::shared_ptr<storage::SQLDatabase> db = scope.database();
-        storage::SQLQuery isItemExistQuery(db->prepare(isItemExistString.str()));
+        storage::SQLQuery isItemExistQuery(db->prepare(SQL_GET_QUICKACCESS_URL_COUNT));
         isItemExistQuery.bindText(1, url);
         isItemExistQuery.exec();
         return static_cast<bool>(isItemExistQuery.getInt(0));
@@ -181,13 +211,10 @@ services::SharedQuickAccessItemVector QuickAccessStorage::getQuickAccessList()
     services::SharedQuickAccessItemVector QAList;
     int QACount = getQuickAccessCount();
     if (QACount > 0) {
-        boost::format getQuickAccessListString("SELECT %1%, %2%, %3%, %4%, %5%, %6%, %7%, %8%, %9% FROM %10% ;");
-        getQuickAccessListString % COL_ID % COL_URL % COL_TITLE % COL_COLOR % COL_ORDER %
-            COL_HAS_FAVICON % COL_FAVICON % COL_WIDTH % COL_HEIGHT % TABLE_QUICKACCESS;
         try {
-            storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS));
+            storage::SQLTransactionScope scope(storage::DriverManager::getDatabase(DB_QUICKACCESS), storage::TransactionMode::Read);
             std::shared_ptr<storage::SQLDatabase> db = scope.database();
-            storage::SQLQuery getQuickAccesListQuery(db->prepare(getQuickAccessListString.str()));
+            storage::SQLQuery getQuickAccesListQuery(db->prepare(SQL_GET_QUICKACCESS_LIST));
             getQuickAccesListQuery.exec();
 
             for (int i = 0; i < QACount; i++) {
@@ -200,13 +227,21 @@ services::SharedQuickAccessItemVector QuickAccessStorage::getQuickAccessList()
                     static_cast<bool>(getQuickAccesListQuery.getInt(5)));
 
                 if (static_cast<bool>(getQuickAccesListQuery.getInt(5))) {
-                    tools::BrowserImagePtr favicon = std::make_shared<tools::BrowserImage>(
-                        getQuickAccesListQuery.getInt(7),
-                        getQuickAccesListQuery.getInt(8),
-                        getQuickAccesListQuery.getBlob(6)->getLength());
-                    favicon->setData(const_cast<void *>(getQuickAccesListQuery.getBlob(6)->getData()),
-                        false, tools::ImageType::ImageTypePNG);
-                    QuickAccesItem->setFavicon(favicon);
+                    tools::BrowserImagePtr favicon;
+                    if (getQuickAccesListQuery.getDataLength(6) > 0) {
+                        std::shared_ptr<tools::Blob> blob = getQuickAccesListQuery.getBlob(6);
+                        favicon = std::make_shared<tools::BrowserImage>(
+                            getQuickAccesListQuery.getInt(7),
+                            getQuickAccesListQuery.getInt(8),
+                            blob->getLength());
+                        void* data = nullptr;
+                        blob->transferData(&data);
+                        favicon->takeData(data, tools::ImageType::ImageTypePNG);
+                    } else {
+                        favicon = FaviconStorage::getInstance().getFavicon(getQuickAccesListQuery.getString(1));
+                    }
+                    if (favicon)
+                        QuickAccesItem->setFavicon(favicon);
                 }
 
                 QAList.push_back(QuickAccesItem);
@@ -22,31 +22,24 @@
 
 #include <string.h>
 #include <stdlib.h>
-#include <chrono>
-#include <thread>
 
 #include <Eina.h>
 
 namespace tizen_browser {
 namespace storage {
 
-#define SQL_RETRY_TIME_US	    100000
-#define SQL_RETRY_COUNT    200
+// time a connection waits for a lock taken by a writer on another connection;
+// in WAL mode readers never wait, so only writers can be delayed
+#define SQL_BUSY_TIMEOUT_MS    2000
+// the main loop must not be blocked for long, even by another writer
+#define SQL_BUSY_TIMEOUT_MAIN_LOOP_MS    50
+#define SQL_STATEMENT_CACHE_SIZE    32
 
 static FieldPtr _null_field(new Field());
 
 static inline int sql_prepare(sqlite3 * db, sqlite3_stmt ** stmt, const char * query)
 {
-    int retry = 0;
-    int rc;
-
-    do {
-        rc = sqlite3_prepare_v2(db, query, -1, stmt, NULL);
-        if(rc == SQLITE_BUSY || rc == SQLITE_LOCKED) {
-            ++retry;
-            std::this_thread::sleep_for(std::chrono::milliseconds(SQL_RETRY_TIME_US));
-        }
-    } while(retry < SQL_RETRY_COUNT && (rc == SQLITE_BUSY || rc == SQLITE_LOCKED));
+    int rc = sqlite3_prepare_v2(db, query, -1, stmt, NULL);
 
     if(rc != SQLITE_OK) {
         BROWSER_LOGE("[sql_db] Can't prepare query from string '%s' with result %d (%s)",
@@ -62,23 +55,10 @@ static inline int sql_prepare(sqlite3 * db, sqlite3_stmt ** stmt, const char * q
 
 static inline int sql_step(sqlite3_stmt * stmt)
 {
-    int rc;
-    int retry = 0;
-
-    do {
-        rc = sqlite3_step(stmt);
-
-        if(rc == SQLITE_LOCKED) {
-            rc = sqlite3_reset(stmt);
-            ++retry;
-            std::this_thread::sleep_for(std::chrono::milliseconds(SQL_RETRY_TIME_US));
-        } else if(rc == SQLITE_BUSY) {
-            ++retry;
-            std::this_thread::sleep_for(std::chrono::milliseconds(SQL_RETRY_TIME_US));
-        }
-    } while(retry < SQL_RETRY_COUNT && (rc == SQLITE_BUSY || rc == SQLITE_LOCKED));
+    // waiting for locks is done by sqlite busy handler, see SQLDatabase::open
+    int rc = sqlite3_step(stmt);
 
-    if(retry == SQL_RETRY_COUNT) {
+    if(rc == SQLITE_BUSY || rc == SQLITE_LOCKED) {
         BROWSER_LOGE("[sql_db] Database timeout");
     }
 
@@ -89,10 +69,16 @@ static inline int sql_step(sqlite3_stmt * stmt)
     return rc;
 }
 
-static inline bool sql_begin(sqlite3 * db)
+static inline bool sql_begin(sqlite3 * db, TransactionMode mode)
 {
+    // read transactions are deferred, so they take no lock until the first
+    // read and never block writers; write transactions take the write lock
+    // at once, to fail early instead of in the middle of the transaction
+    const char * command = mode == TransactionMode::Read ?
+            "BEGIN DEFERRED TRANSACTION" : "BEGIN IMMEDIATE TRANSACTION";
+
     sqlite3_stmt * stmt  = 0;
-    if(sql_prepare(db, &stmt, "BEGIN EXCLUSIVE TRANSACTION")) {
+    if(sql_prepare(db, &stmt, command)) {
         BROWSER_LOGE("[sql_db] Can't begin SQL transaction");
         return false;
     }
@@ -170,7 +156,13 @@ SQLQueryPrivate::SQLQueryPrivate(const SQLQueryPrivate& other) :
 
 SQLQueryPrivate::~SQLQueryPrivate()
 {
-    if(_stmt)
+    if(!_stmt)
+        return;
+
+    std::shared_ptr<SQLDatabase> db = _db_ref.lock();
+    if(db && db->d->_db == _db)
+        db->d->releaseStatement(_query, _stmt);
+    else
         sqlite3_finalize(_stmt);
 }
 
@@ -186,12 +178,64 @@ SQLDatabasePrivate::~SQLDatabasePrivate()
 
 void SQLDatabasePrivate::close()
 {
+    clearStatements();
     if(_db) {
         sqlite3_close(_db);
         _db = NULL;
     }
 }
 
+int SQLDatabasePrivate::acquireStatement(const std::string& query, sqlite3_stmt ** stmt)
+{
+    {
+        std::lock_guard<std::mutex> lock(_statementsMutex);
+        auto it = _statementsIndex.find(query);
+        if(it != _statementsIndex.end()) {
+            *stmt = it->second->second;
+            _statements.erase(it->second);
+            _statementsIndex.erase(it);
+            return SQLITE_OK;
+        }
+    }
+
+    return sql_prepare(_db, stmt, query.c_str());
+}
+
+void SQLDatabasePrivate::releaseStatement(const std::string& query, sqlite3_stmt * stmt)
+{
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    sqlite3_stmt * unused = NULL;
+    {
+        std::lock_guard<std::mutex> lock(_statementsMutex);
+        if(_statementsIndex.count(query)) {
+            // the same query was executed twice at once, one statement is enough
+            unused = stmt;
+        } else {
+            _statements.emplace_front(query, stmt);
+            _statementsIndex[query] = _statements.begin();
+            if(_statements.size() > SQL_STATEMENT_CACHE_SIZE) {
+                unused = _statements.back().second;
+                _statementsIndex.erase(_statements.back().first);
+                _statements.pop_back();
+            }
+        }
+    }
+
+    if(unused)
+        sqlite3_finalize(unused);
+}
+
+void SQLDatabasePrivate::clearStatements()
+{
+    std::lock_guard<std::mutex> lock(_statementsMutex);
+    for(auto& statement : _statements)
+        sqlite3_finalize(statement.second);
+    _statements.clear();
+    _statementsIndex.clear();
+}
+
 SQLQuery::SQLQuery() :
     d(NULL)
 {
@@ -597,6 +641,15 @@ void SQLDatabase::open(const std::string& path)
         throw StorageException(sqlite3_errmsg(d->_db), error);
     }
 
+    d->_path = path;
+    sqlite3_busy_timeout(d->_db, eina_main_loop_is() ? SQL_BUSY_TIMEOUT_MAIN_LOOP_MS : SQL_BUSY_TIMEOUT_MS);
+
+    // readers do not block writer and writer does not block readers
+    SQLQuery journalMode(prepare("PRAGMA journal_mode = WAL"));
+    journalMode.exec();
+    // WAL is durable on checkpoint, commits do not need to sync
+    SQLQuery synchronous(prepare("PRAGMA synchronous = NORMAL"));
+    synchronous.exec();
     SQLQuery query(prepare("PRAGMA foreign_keys = ON"));
     query.exec();
 }
@@ -611,7 +664,7 @@ SQLQuery SQLDatabase::prepare(const std::string& query) const
     EINA_SAFETY_ON_NULL_RETURN_VAL(d->_db, SQLQuery());
 
     sqlite3_stmt * stmt = NULL;
-    int rc = sql_prepare(d->_db, &stmt, query.c_str());
+    int rc = d->acquireStatement(query, &stmt);
 
     if(rc != SQLITE_OK) {
         BROWSER_LOGE("[SQLDatabase] Can't prepare query from string '%s' with result %d (%s)",
@@ -711,9 +764,9 @@ std::vector<std::string> SQLDatabase::tableColumnNames(const std::string& table)
     return result;
 }
 
-void SQLDatabase::begin()
+void SQLDatabase::begin(TransactionMode mode)
 {
-    if(!sql_begin(d->_db)) {
+    if(!sql_begin(d->_db, mode)) {
         throw StorageException(sqlite3_errmsg(d->_db), sqlite3_errcode(d->_db));
     }
 }
@@ -730,8 +783,10 @@ void SQLDatabase::rollback()
     sql_rollback(d->_db);
 }
 
-std::shared_ptr<SQLDatabase> SQLDatabase::cloneForThread(void)
+std::shared_ptr<SQLDatabase> SQLDatabase::cloneForThread(void) const
 {
+    M_ASSERT(d->_db);
+
     std::shared_ptr<SQLDatabase> result(newInstance());
     result->open(d->_path);
     return result;
@@ -31,6 +31,17 @@ class SQLDatabase;
 class SQLQueryPrivate;
 class SQLDatabasePrivate;
 
+/*! \brief Kind of transaction started by SQLDatabase::begin.
+ *
+ * Read transactions are deferred and do not block any other connection.
+ * Write transactions take database write lock immediately.
+ */
+enum class TransactionMode
+{
+	Read,
+	Write
+};
+
 /*! \brief Represents query result.
  *
  * Parameter positions start from 1
@@ -275,6 +286,9 @@ public:
 	static std::shared_ptr<SQLDatabase> newInstance();
 
 	/*! \brief Open/create sqlite database file.
+	 *
+	 * Database is switched to WAL journal, so readers are never blocked
+	 * by a writer on another connection.
 	 *
 	 * \param path - path to sqlite database file to open/create.
 	 */
@@ -287,6 +301,9 @@ public:
 	void close();
 
 	/*! \brief Execute SQL on database.
+	 *
+	 * Prepared statements are cached by query text and reused by next calls,
+	 * so query should use positional parameters instead of embedded values.
 	 *
 	 * \param query - query to be executed on database.
 	 * \return SQLQuery object representing query result.
@@ -334,12 +351,12 @@ public:
 
 	/*! \brief Start transaction on database.
 	 *
-	 *  \return True if transaction has been started successfully.
+	 *  \param mode - Read for transactions which only select data.
 	 *
 	 *  \pre Database must be opened.
      *  \throws StorageException on error
 	 */
-	void begin();
+	void begin(TransactionMode mode = TransactionMode::Write);
 
 	/*! \brief Commit transaction on database.
 	 *
@@ -356,8 +373,13 @@ public:
 
 	/*! \brief Create copy of database object to be used in another thread
 	 *
+	 * Opens new connection to the same database file. Connections do not
+	 * share prepared statements, so each thread should use its own one,
+	 * see DriverManager::getDatabase.
+	 *
+	 * \pre Database must be opened.
 	 */
-	std::shared_ptr<SQLDatabase> cloneForThread(void);
+	std::shared_ptr<SQLDatabase> cloneForThread(void) const;
 
 protected:
 	SQLDatabase();
@@ -365,6 +387,7 @@ protected:
 	static std::shared_ptr<SQLDatabase> make_shared();
 
 private:
+	friend class SQLQueryPrivate;
 	SQLDatabase(const SQLDatabase&);
 	SQLDatabase& operator = (const SQLDatabase&);
 
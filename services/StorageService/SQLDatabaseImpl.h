@@ -18,6 +18,9 @@
 #define SQLDATABASEIMPL_H_
 
 #include <sqlite3.h>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include "SQLDatabase.h"
 
 namespace tizen_browser {
@@ -45,9 +48,32 @@ public:
 
 	void close();
 
+	/*! \brief Take prepared statement for query from cache or prepare new one.
+	 *
+	 * Statement is removed from cache until it is released, so it is never
+	 * shared by two queries.
+	 */
+	int acquireStatement(const std::string& query, sqlite3_stmt ** stmt);
+
+	/*! \brief Reset statement, clear its bindings and put it back to cache.
+	 *
+	 * The least recently used statement is finalized when cache is full.
+	 */
+	void releaseStatement(const std::string& query, sqlite3_stmt * stmt);
+
+	void clearStatements();
+
 	std::string _path;
 	sqlite3 * _db;
 	std::weak_ptr<SQLDatabase> _db_self_weak;
+
+private:
+	typedef std::list< std::pair<std::string, sqlite3_stmt *> > StatementList;
+
+	std::mutex _statementsMutex;
+	// the most recently used statement first
+	StatementList _statements;
+	std::unordered_map<std::string, StatementList::iterator> _statementsIndex;
 };
 
 }
@@ -22,13 +22,13 @@
 namespace tizen_browser {
 namespace storage {
 
-SQLTransactionScope::SQLTransactionScope(std::shared_ptr<SQLDatabase> db) :
+SQLTransactionScope::SQLTransactionScope(std::shared_ptr<SQLDatabase> db, TransactionMode mode) :
     _db(db),
     _inTransaction(false)
 {
     M_ASSERT(db);
 
-    db->begin();
+    db->begin(mode);
     _inTransaction = true;
 }
 
@@ -20,23 +20,24 @@
 #include <boost/noncopyable.hpp>
 #include <memory>
 
+#include "SQLDatabase.h"
+
 
 namespace tizen_browser {
 namespace storage {
 
-class SQLDatabase;
-
 /*! \brief Holds SQL transaction.
  *
  * On exception rolls the transaction back. On normal destruction
- * commits the transaction
+ * commits the transaction. Scopes which only read data should pass
+ * TransactionMode::Read, so they do not take the write lock.
  */
 class SQLTransactionScope : boost::noncopyable
 {
     std::shared_ptr<SQLDatabase> _db;
     bool _inTransaction;
 public:
-    SQLTransactionScope(std::shared_ptr<SQLDatabase> db);
+    SQLTransactionScope(std::shared_ptr<SQLDatabase> db, TransactionMode mode = TransactionMode::Write);
     ~SQLTransactionScope();
     void commit();
     void rollback();
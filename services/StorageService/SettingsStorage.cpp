@@ -15,6 +15,7 @@
  */
 
 #include <string>
+#include <chrono>
 #include <BrowserAssert.h>
 #include <boost/any.hpp>
 
@@ -28,6 +29,7 @@
 #include "Config.h"
 #include "SettingsStorage.h"
 #include "DBTools.h"
+#include "SQLTransactionScope.h"
 
 namespace
 {
@@ -64,20 +66,15 @@ const std::string DELETE_SETTING = "delete from " + TABLE_SETTINGS + " where "
 
 const std::string DELETE_ALL_SETTINGS = "delete from " + TABLE_SETTINGS;
 
-const std::string SQL_FIND_VALUE_INT_SETTINGS = "select " + COL_SETTINGS_VALUE_INT + " from " + TABLE_SETTINGS
-                                                + " where " + COL_SETTINGS_KEY + "=?";
-
-const std::string SQL_FIND_VALUE_DOUBLE_SETTINGS = "select " + COL_SETTINGS_VALUE_DOUBLE + " from " + TABLE_SETTINGS
-                                                   + " where " + COL_SETTINGS_KEY + "=?";
-
-const std::string SQL_FIND_VALUE_TEXT_SETTINGS = "select " + COL_SETTINGS_VALUE_TEXT + " from " + TABLE_SETTINGS
-                                                 + " where " + COL_SETTINGS_KEY + "=?";
-
-const std::string SQL_CHECK_IF_PARAM_EXISTS = "select " + COL_SETTINGS_KEY + " from " + TABLE_SETTINGS
-                                                + " where " + COL_SETTINGS_KEY + "=?";
+const std::string SQL_FIND_ALL_SETTINGS = "select " + COL_SETTINGS_KEY + ", " + COL_SETTINGS_VALUE_INT + ", "
+                                         + COL_SETTINGS_VALUE_DOUBLE + ", " + COL_SETTINGS_VALUE_TEXT
+                                         + " from " + TABLE_SETTINGS;
 
 // ------ (end) Database SETTINGS ------
 
+// changes made within this time are written in one transaction
+const std::chrono::milliseconds SETTINGS_FLUSH_DELAY(500);
+
 }
 
 namespace tizen_browser {
@@ -86,6 +83,9 @@ namespace storage {
 SettingsStorage::SettingsStorage()
     : m_dbSettingsInitialised(false)
     , m_isInitialized(false)
+    , m_flushRequested(false)
+    , m_flushing(false)
+    , m_quit(false)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     init();
@@ -93,6 +93,14 @@ SettingsStorage::SettingsStorage()
 
 SettingsStorage::~SettingsStorage()
 {
+    {
+        std::lock_guard<std::mutex> lock(m_flushMutex);
+        m_quit = true;
+    }
+    m_flushCondition.notify_all();
+    // pending changes are stored before thread exits
+    if (m_flushThread.joinable())
+        m_flushThread.join();
 }
 
 void SettingsStorage::resetSettings()
@@ -145,6 +153,7 @@ void SettingsStorage::init(bool testmode)
 
     try {
         initDatabaseSettings(DB_SETTINGS);
+        loadSettings();
     } catch (storage::StorageExceptionInitialization & e) {
         BROWSER_LOGE("[%s:%d] Cannot initialize database %s!", __PRETTY_FUNCTION__, __LINE__, DB_SETTINGS.c_str());
     }
@@ -152,6 +161,33 @@ void SettingsStorage::init(bool testmode)
     m_isInitialized = true;
 }
 
+void SettingsStorage::loadSettings()
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    Values values;
+    try {
+        auto con = storage::DriverManager::getDatabase(DB_SETTINGS);
+        storage::SQLQuery select(con->prepare(SQL_FIND_ALL_SETTINGS));
+        select.exec();
+        while (select.hasNext()) {
+            Value value;
+            value.valueInt = select.getInt(1);
+            value.valueDouble = select.getDouble(2);
+            value.valueText = select.getString(3);
+            for (int column = 1; column <= 3 && value.type == 0; ++column)
+                if (select.fieldType(column) != SQLITE_NULL)
+                    value.type = select.fieldType(column);
+            values[select.getString(0)] = value;
+            select.next();
+        }
+    } catch (storage::StorageException & e) {
+        BROWSER_LOGE("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+    }
+
+    std::lock_guard<std::mutex> lock(m_valuesMutex);
+    m_values.swap(values);
+}
+
 /**
  * @throws StorageExceptionInitialization on error
  */
@@ -198,11 +234,8 @@ void SettingsStorage::setParamString(basic_webengine::WebEngineSettings param, s
 
 bool SettingsStorage::isDBParamPresent(const std::string& key) const
 {
-    auto con = storage::DriverManager::getDatabase(DB_SETTINGS);
-    storage::SQLQuery select(con->prepare(SQL_CHECK_IF_PARAM_EXISTS));
-    select.bindText(1, key);
-    select.exec();
-    return select.hasNext();
+    std::lock_guard<std::mutex> lock(m_valuesMutex);
+    return m_values.count(key) > 0;
 }
 
 bool SettingsStorage::isParamPresent(basic_webengine::WebEngineSettings param) const
@@ -218,9 +251,6 @@ bool SettingsStorage::getParamVal(basic_webengine::WebEngineSettings param) cons
     return static_cast<bool>(getSettingsInt(paramName, 0));
 }
 
-/**
- * @throws StorageException on error
- */
 std::string SettingsStorage::getParamString(basic_webengine::WebEngineSettings param) const
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
@@ -228,58 +258,32 @@ std::string SettingsStorage::getParamString(basic_webengine::WebEngineSettings p
     return getSettingsText(paramName, std::string());
 }
 
-/**
- * @throws StorageException on error
- */
-int SettingsStorage::getSettingsInt(const std::string & key, const int defaultValue) const
+bool SettingsStorage::getValue(const std::string & key, Value & value) const
 {
-    auto con = storage::DriverManager::getDatabase(DB_SETTINGS);
-
-    storage::SQLQuery select(con->prepare(SQL_FIND_VALUE_INT_SETTINGS));
-    select.bindText(1, key);
-    select.exec();
-
-    if (select.hasNext()) {
-        return select.getInt(0);
-    }
+    std::lock_guard<std::mutex> lock(m_valuesMutex);
+    auto it = m_values.find(key);
+    if (it == m_values.end())
+        return false;
+    value = it->second;
+    return true;
+}
 
-    return defaultValue;
+int SettingsStorage::getSettingsInt(const std::string & key, const int defaultValue) const
+{
+    Value value;
+    return getValue(key, value) ? value.valueInt : defaultValue;
 }
 
-/**
- * @throws StorageException on error
- */
 double SettingsStorage::getSettingsDouble(const std::string & key, const double defaultValue) const
 {
-    auto con = storage::DriverManager::getDatabase(DB_SETTINGS);
-
-    storage::SQLQuery select(con->prepare(SQL_FIND_VALUE_DOUBLE_SETTINGS));
-    select.bindText(1, key);
-    select.exec();
-
-    if (select.hasNext()) {
-        return select.getDouble(0);
-    }
-
-    return defaultValue;
+    Value value;
+    return getValue(key, value) ? value.valueDouble : defaultValue;
 }
 
-/**
- * @throws StorageException on error
- */
 const std::string SettingsStorage::getSettingsText(const std::string & key, const std::string & defaultValue) const
 {
-    auto con = storage::DriverManager::getDatabase(DB_SETTINGS);
-
-    storage::SQLQuery select(con->prepare(SQL_FIND_VALUE_TEXT_SETTINGS));
-    select.bindText(1, key);
-    select.exec();
-
-    if (select.hasNext()) {
-        return select.getString(0);
-    }
-
-    return defaultValue;
+    Value value;
+    return getValue(key, value) ? value.valueText : defaultValue;
 }
 
 bool SettingsStorage::getSettingsBool(const std::string & key, const bool defaultValue) const
@@ -292,27 +296,20 @@ bool SettingsStorage::getSettingsBool(const std::string & key, const bool defaul
         return static_cast<bool>(value);
 }
 
-/**
- * @throws StorageException on error
- */
 void SettingsStorage::setSettingsValue(const std::string & key, storage::FieldPtr field) const
 {
-    auto con = storage::DriverManager::getDatabase(DB_SETTINGS);
-
-    storage::SQLQuery insert;
-
-    switch (field->getType()) {
+    // row is replaced, so columns not set by this value are cleared
+    Value value;
+    value.type = field->getType();
+    switch (value.type) {
         case SQLITE_INTEGER:
-            insert = con->prepare(INSERT_TABLE_SETTINGS_INT_VALUE);
-            insert.bindInt(2, field->getInt());
+            value.valueInt = field->getInt();
             break;
         case SQLITE_FLOAT:
-            insert = con->prepare(INSERT_TABLE_SETTINGS_DOUBLE_VALUE);
-            insert.bindDouble(2, field->getDouble());
+            value.valueDouble = field->getDouble();
             break;
         case SQLITE3_TEXT:
-            insert = con->prepare(INSERT_TABLE_SETTINGS_TEXT_VALUE);
-            insert.bindText(2, field->getString());
+            value.valueText = field->getString();
             break;
         default:
             BROWSER_LOGE("[%s:%d] Unknown filed type!", __PRETTY_FUNCTION__, __LINE__);
@@ -320,13 +317,84 @@ void SettingsStorage::setSettingsValue(const std::string & key, storage::FieldPt
             return;
     }
 
-    insert.bindText(1, key);
-    insert.exec();
+    {
+        std::lock_guard<std::mutex> lock(m_valuesMutex);
+        m_values[key] = value;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_flushMutex);
+        m_pendingValues[key] = value;
+        if (!m_flushThread.joinable())
+            m_flushThread = std::thread(&SettingsStorage::runFlush, this);
+    }
+    m_flushCondition.notify_all();
+}
+
+void SettingsStorage::flush() const
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+    if (!m_flushThread.joinable())
+        return;
+    m_flushRequested = true;
+    m_flushCondition.notify_all();
+    m_flushCondition.wait(lock, [this]() { return m_pendingValues.empty() && !m_flushing; });
+    m_flushRequested = false;
+}
+
+void SettingsStorage::runFlush() const
+{
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+    for (;;) {
+        m_flushCondition.wait(lock, [this]() { return m_quit || !m_pendingValues.empty(); });
+        if (!m_quit && !m_flushRequested)
+            m_flushCondition.wait_for(lock, SETTINGS_FLUSH_DELAY,
+                [this]() { return m_quit || m_flushRequested; });
+        if (m_pendingValues.empty())
+            return;
+
+        std::map<std::string, Value> values;
+        values.swap(m_pendingValues);
+        m_flushing = true;
+        lock.unlock();
+        storeValues(values);
+        lock.lock();
+        m_flushing = false;
+        m_flushCondition.notify_all();
+    }
+}
+
+void SettingsStorage::storeValues(const std::map<std::string, Value>& values) const
+{
+    BROWSER_LOGD("[%s:%d] %zu values", __PRETTY_FUNCTION__, __LINE__, values.size());
+    try {
+        // connection of the flush thread, not shared with the main loop
+        auto con = storage::DriverManager::getDatabase(DB_SETTINGS);
+        storage::SQLTransactionScope scope(con);
+        for (auto& value : values) {
+            storage::SQLQuery insert;
+            switch (value.second.type) {
+                case SQLITE_INTEGER:
+                    insert = con->prepare(INSERT_TABLE_SETTINGS_INT_VALUE);
+                    insert.bindInt(2, value.second.valueInt);
+                    break;
+                case SQLITE_FLOAT:
+                    insert = con->prepare(INSERT_TABLE_SETTINGS_DOUBLE_VALUE);
+                    insert.bindDouble(2, value.second.valueDouble);
+                    break;
+                default:
+                    insert = con->prepare(INSERT_TABLE_SETTINGS_TEXT_VALUE);
+                    insert.bindText(2, value.second.valueText);
+                    break;
+            }
+            insert.bindText(1, value.first);
+            insert.exec();
+        }
+    } catch (storage::StorageException & e) {
+        BROWSER_LOGE("[%s:%d] SQLException (%d): %s ", __PRETTY_FUNCTION__, __LINE__, e.getErrorCode(), e.getMessage());
+    }
 }
 
-/**
- * @throws StorageException on error
- */
 void SettingsStorage::setSettingsInt(const std::string & key, int value) const
 {
     BROWSER_LOGD("[%s:%d:%d] ", __PRETTY_FUNCTION__, __LINE__, value);
@@ -334,27 +402,18 @@ void SettingsStorage::setSettingsInt(const std::string & key, int value) const
     setSettingsValue(key, field);
 }
 
-/**
- * @throws StorageException on error
- */
 void SettingsStorage::setSettingsDouble(const std::string & key, double value) const
 {
     storage::FieldPtr field = std::make_shared<storage::Field>(value);
     setSettingsValue(key, field);
 }
 
-/**
- * @throws StorageException on error
- */
 void SettingsStorage::setSettingsString(const std::string & key, std::string value) const
 {
     storage::FieldPtr field = std::make_shared<storage::Field>(value);
     setSettingsValue(key, field);
 }
 
-/**
- * @throws StorageException on error
- */
 void SettingsStorage::setSettingsBool(const std::string & key, bool value) const
 {
     BROWSER_LOGD("[%s:%d:%d] ", __PRETTY_FUNCTION__, __LINE__, value);
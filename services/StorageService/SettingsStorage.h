@@ -17,7 +17,12 @@
 #ifndef __STORAGESERVICE_H
 #define __STORAGESERVICE_H
 
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <boost/signals2/signal.hpp>
 
 #include "SQLDatabase.h"
@@ -27,6 +32,14 @@
 namespace tizen_browser {
 namespace storage {
 
+/**
+ * @brief Settings kept in memory and written through to the database.
+ *
+ * All settings are read from the database once, in init(). Getters are served
+ * from memory only. Setters update memory and schedule a write; writes made
+ * shortly one after another are stored together, in one transaction, by
+ * a background thread.
+ */
 class SettingsStorage
 {
 public:
@@ -38,64 +51,50 @@ public:
     void setParamString(basic_webengine::WebEngineSettings param, std::string value) const;
     bool getParamVal(basic_webengine::WebEngineSettings param) const;
     bool isDBParamPresent(const std::string& key) const;
-    /**
-     * @throws StorageException on error
-     */
     std::string getParamString(basic_webengine::WebEngineSettings param) const;
-    /**
-     * @throws StorageException on error
-     */
     int getSettingsInt(const std::string & key, const int defaultValue) const;
-
-    /**
-     * @throws StorageException on error
-     */
     double getSettingsDouble(const std::string & key, const double defaultValue) const;
-
-    /**
-     * @throws StorageException on error
-     */
     const std::string getSettingsText(const std::string & key, const std::string & defaultValue) const;
-
-    /**
-     * @throws StorageException on error
-     */
     bool getSettingsBool(const std::string & key, const bool defaultValue) const;
 
-    /**
-     * @throws StorageException on error
-     */
     void setSettingsInt(const std::string & key, int value) const;
-
-    /**
-     * @throws StorageException on error
-     */
     void setSettingsDouble(const std::string & key, double value) const;
-
-    /**
-     * @throws StorageException on error
-     */
     void setSettingsString(const std::string & key, std::string value) const;
+    void setSettingsBool(const std::string & key, bool value) const;
 
     /**
-     * @throws StorageException on error
+     * @brief Writes pending changes to the database, blocks until they are
+     * stored. Should be called when application may be killed.
      */
-    void setSettingsBool(const std::string & key, bool value) const;
+    void flush() const;
 
     void init(bool testmode = false);
 
     void initWebEngineSettingsFromDB();
     boost::signals2::signal<void (basic_webengine::WebEngineSettings, bool)> setWebEngineSettingsParam;
 private:
+    // row of settings table, column which is not set keeps default value
+    struct Value
+    {
+        Value() : valueInt(0), valueDouble(0.0), type(0) {}
+        int valueInt;
+        double valueDouble;
+        std::string valueText;
+        // sqlite type of the column which is set
+        int type;
+    };
+    using Values = std::unordered_map<std::string, Value>;
+
     /**
      * @throws StorageExceptionInitialization on error
      */
     void initDatabaseSettings(const std::string & db_str);
 
-    /**
-     * @throws StorageExceptionInitialization on error
-     */
+    void loadSettings();
     void setSettingsValue(const std::string & key, storage::FieldPtr field) const;
+    bool getValue(const std::string & key, Value & value) const;
+    void runFlush() const;
+    void storeValues(const std::map<std::string, Value>& values) const;
 
     bool isParamPresent(basic_webengine::WebEngineSettings param) const;
 
@@ -103,6 +102,18 @@ private:
     std::string DB_SETTINGS;
 
     bool m_isInitialized;
+
+    mutable std::mutex m_valuesMutex;
+    mutable Values m_values;
+
+    // written by flush thread, ordered to store them always in the same order
+    mutable std::mutex m_flushMutex;
+    mutable std::condition_variable m_flushCondition;
+    mutable std::map<std::string, Value> m_pendingValues;
+    mutable bool m_flushRequested;
+    mutable bool m_flushing;
+    mutable bool m_quit;
+    mutable std::thread m_flushThread;
 };
 
 }
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iterator>
+#include "ImageCache.h"
+
+namespace tizen_browser {
+namespace services {
+
+ImageCache::ImageCache(std::size_t budget)
+    : m_budget(budget)
+    , m_size(0)
+    , m_hits(0)
+    , m_misses(0)
+    , m_evictions(0)
+{
+}
+
+std::size_t ImageCache::imageSize(const tools::BrowserImagePtr& image)
+{
+    return (image && image->getSize() > 0) ? static_cast<std::size_t>(image->getSize()) : 0;
+}
+
+boost::optional<tools::BrowserImagePtr> ImageCache::get(int id)
+{
+    auto it = m_index.find(id);
+    if (it == m_index.end()) {
+        ++m_misses;
+        return boost::none;
+    }
+    ++m_hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->image;
+}
+
+bool ImageCache::contains(int id) const
+{
+    return m_index.find(id) != m_index.end();
+}
+
+void ImageCache::put(int id, tools::BrowserImagePtr image)
+{
+    remove(id);
+
+    const std::size_t size = imageSize(image);
+    if (size > m_budget) {
+        ++m_evictions;
+        return;
+    }
+    while (m_size + size > m_budget) {
+        erase(std::prev(m_entries.end()));
+        ++m_evictions;
+    }
+
+    m_entries.push_front(Entry{id, image, size});
+    m_index[id] = m_entries.begin();
+    m_size += size;
+}
+
+void ImageCache::remove(int id)
+{
+    auto it = m_index.find(id);
+    if (it != m_index.end())
+        erase(it->second);
+}
+
+void ImageCache::clear()
+{
+    m_entries.clear();
+    m_index.clear();
+    m_size = 0;
+}
+
+void ImageCache::erase(Entries::iterator it)
+{
+    m_size -= it->size;
+    m_index.erase(it->id);
+    m_entries.erase(it);
+}
+
+} /* namespace services */
+} /* namespace tizen_browser */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IMAGECACHE_H_
+#define IMAGECACHE_H_
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <boost/optional.hpp>
+#include "BrowserImage.h"
+
+namespace tizen_browser {
+namespace services {
+
+/**
+ * @brief Images of tabs kept in memory, limited by size of image data.
+ *
+ * When adding an image would exceed the budget, the least recently used
+ * images are evicted. An image bigger than the whole budget is not cached.
+ * Cache does not keep evicted images anywhere. TabService reads them from
+ * the database again, or, while their database write is pending, from its
+ * unsaved images.
+ */
+class ImageCache
+{
+public:
+    /**
+     * @param budget maximum size of cached image data, in bytes
+     */
+    explicit ImageCache(std::size_t budget);
+
+    /**
+     * @brief Get image for given tab id and mark it as recently used.
+     *
+     * @return Image or boost::none.
+     */
+    boost::optional<tools::BrowserImagePtr> get(int id);
+
+    bool contains(int id) const;
+
+    /**
+     * @brief Insert or replace image for given tab id.
+     */
+    void put(int id, tools::BrowserImagePtr image);
+
+    void remove(int id);
+    void clear();
+
+    /// size of cached image data, in bytes
+    std::size_t size() const { return m_size; }
+    std::size_t budget() const { return m_budget; }
+    std::size_t count() const { return m_index.size(); }
+
+    unsigned hits() const { return m_hits; }
+    unsigned misses() const { return m_misses; }
+    unsigned evictions() const { return m_evictions; }
+
+private:
+    struct Entry
+    {
+        int id;
+        tools::BrowserImagePtr image;
+        // size at the time of insertion, image may change later
+        std::size_t size;
+    };
+    using Entries = std::list<Entry>;
+
+    static std::size_t imageSize(const tools::BrowserImagePtr& image);
+    void erase(Entries::iterator it);
+
+    const std::size_t m_budget;
+    std::size_t m_size;
+    // the most recently used image first
+    Entries m_entries;
+    std::unordered_map<int, Entries::iterator> m_index;
+
+    unsigned m_hits;
+    unsigned m_misses;
+    unsigned m_evictions;
+};
+
+} /* namespace services */
+} /* namespace tizen_browser */
+
+#endif /* IMAGECACHE_H_ */
@@ -22,13 +22,48 @@
 #include "TabId.h"
 #include <web/web_tab.h>
 #include "CapiWebErrorCodes.h"
+#include "Config.h"
+#include "FaviconStorage.h"
+#include "GeneralTools.h"
 
 namespace tizen_browser {
 namespace services {
 
 EXPORT_SERVICE(TabService, DOMAIN_TAB_SERVICE)
 
+namespace {
+
+std::size_t cacheBudget(CONFIG_KEY key)
+{
+    return boost::any_cast<int>(config::Config::getInstance().get(key));
+}
+
+// favicons and raw thumbs of several tabs are encoded while pages load
+const std::size_t ENCODER_THREADS = 2;
+
+std::string thumbKey(const basic_webengine::TabId& tabId)
+{
+    return "thumb:" + tabId.toString();
+}
+
+std::string faviconKey(const basic_webengine::TabId& tabId)
+{
+    return "favicon:" + tabId.toString();
+}
+
+void logCacheStats(const char* name, const ImageCache& cache)
+{
+    BROWSER_LOGD("[%s] %zu images, %zu/%zu bytes, hits: %u, misses: %u, evictions: %u",
+        name, cache.count(), cache.size(), cache.budget(),
+        cache.hits(), cache.misses(), cache.evictions());
+}
+
+}
+
 TabService::TabService()
+    : m_thumbCache(cacheBudget(CONFIG_KEY::TAB_SERVICE_THUMB_CACHE_SIZE))
+    , m_faviconCache(cacheBudget(CONFIG_KEY::TAB_SERVICE_FAVICON_CACHE_SIZE))
+    , m_encoder(ENCODER_THREADS)
 {
     if (bp_tab_adaptor_initialize() < 0)
         errorPrint("bp_tab_adaptor_initialize");
@@ -119,20 +154,23 @@ tools::BrowserImagePtr TabService::getThumb(const basic_webengine::TabId& tabId)
     if (imageCache)
         return *imageCache;
 
+    auto unsaved = m_unsavedThumbs.find(tabId.get());
+    if (unsaved != m_unsavedThumbs.end()) {
+        saveThumbCache(tabId, unsaved->second);
+        return unsaved->second;
+    }
+
     auto imageDatabase = getThumbDatabase(tabId);
     if (imageDatabase) {
         saveThumbCache(tabId, *imageDatabase);
         return *imageDatabase;
     }
 
+    // thumb is generated asynchronously and saved with updateTabItemSnapshot,
+    // empty image is shown until then
     BROWSER_LOGD("%s [%d] generating thumb", __FUNCTION__, tabId.get());
     generateThumb(tabId);
-
-    imageCache = getThumbCache(tabId);
-    if (imageCache)
-        return *imageCache;
-    else
-        return std::make_shared<tools::BrowserImage>();
+    return std::make_shared<tools::BrowserImage>();
 }
 
 tools::BrowserImagePtr TabService::getFavicon(const basic_webengine::TabId& tabId)
@@ -141,6 +179,12 @@ tools::BrowserImagePtr TabService::getFavicon(const basic_webengine::TabId& tabI
     if (imageCache)
         return *imageCache;
 
+    auto unsaved = m_unsavedFavicons.find(tabId.get());
+    if (unsaved != m_unsavedFavicons.end()) {
+        saveFaviconCache(tabId, unsaved->second);
+        return unsaved->second;
+    }
+
     auto imageDatabase = getFaviconDatabase(tabId);
     if (imageDatabase) {
         saveFaviconCache(tabId, *imageDatabase);
@@ -160,22 +204,22 @@ tools::BrowserImagePtr TabService::getFavicon(const basic_webengine::TabId& tabI
 boost::optional<tools::BrowserImagePtr> TabService::getThumbCache(
     const basic_webengine::TabId& tabId)
 {
-    if (!thumbCached(tabId))
-        return boost::none;
-    return m_thumbMap.find(tabId.get())->second;
+    return m_thumbCache.get(tabId.get());
 }
 
 boost::optional<tools::BrowserImagePtr> TabService::getFaviconCache(
     const basic_webengine::TabId& tabId)
 {
-    if (!faviconCached(tabId))
-        return boost::none;
-    return m_faviconMap.find(tabId.get())->second;
+    return m_faviconCache.get(tabId.get());
 }
 
 void TabService::removeTab(const basic_webengine::TabId& tabId)
 {
     BROWSER_LOGD("[%s:%d] tab id: %d", __PRETTY_FUNCTION__, __LINE__, tabId.get());
+    m_encoder.cancel(thumbKey(tabId));
+    m_encoder.cancel(faviconKey(tabId));
+    m_unsavedThumbs.erase(tabId.get());
+    m_unsavedFavicons.erase(tabId.get());
     clearFromDatabase(tabId);
     clearFromCache(tabId);
     clearFaviconFromCache(tabId);
@@ -188,6 +232,7 @@ void TabService::fillThumbs(
         auto thumbPtr = getThumb(tc->getId());
         tc->setThumbnail(thumbPtr);
     }
+    logCacheStats("thumbs", m_thumbCache);
 }
 
 void TabService::fillFavicons(
@@ -197,6 +242,7 @@ void TabService::fillFavicons(
         auto faviconPtr = getFavicon(tc->getId());
         tc->setFavicon(faviconPtr);
     }
+    logCacheStats("favicons", m_faviconCache);
 }
 
 void TabService::updateTabItem(
@@ -250,34 +296,34 @@ void TabService::saveThumbCache(
     const basic_webengine::TabId& tabId,
     tools::BrowserImagePtr imagePtr)
 {
-    m_thumbMap[tabId.get()] = imagePtr;
+    m_thumbCache.put(tabId.get(), imagePtr);
 }
 
 void TabService::saveFaviconCache(
     const basic_webengine::TabId& tabId,
     tools::BrowserImagePtr imagePtr)
 {
-    m_faviconMap[tabId.get()] = imagePtr;
+    m_faviconCache.put(tabId.get(), imagePtr);
 }
 
 bool TabService::thumbCached(const basic_webengine::TabId& tabId) const
 {
-    return m_thumbMap.find(tabId.get()) != m_thumbMap.end();
+    return m_thumbCache.contains(tabId.get());
 }
 
 bool TabService::faviconCached(const basic_webengine::TabId& tabId) const
 {
-    return m_faviconMap.find(tabId.get()) != m_faviconMap.end();
+    return m_faviconCache.contains(tabId.get());
 }
 
 void TabService::clearFromCache(const basic_webengine::TabId& tabId)
 {
-    m_thumbMap.erase(tabId.get());
+    m_thumbCache.remove(tabId.get());
 }
 
 void TabService::clearFaviconFromCache(const basic_webengine::TabId& tabId)
 {
-    m_faviconMap.erase(tabId.get());
+    m_faviconCache.remove(tabId.get());
 }
 
 void TabService::clearFromDatabase(const basic_webengine::TabId& tabId)
@@ -291,20 +337,25 @@ void TabService::saveThumbDatabase(
     tools::BrowserImagePtr imagePtr)
 {
     BROWSER_LOGD("[%s:%d] tabId: %d", __PRETTY_FUNCTION__, __LINE__, tabId.get());
-    auto thumb_blob = tools::EflTools::getBlobPNG(imagePtr);
-    if (!thumb_blob) {
-        BROWSER_LOGW("getBlobPNG failed");
-        return;
-    }
-    auto thumbData = std::move((unsigned char*)thumb_blob->getData());
-    if (bp_tab_adaptor_set_snapshot(
-        tabId.get(),
-        imagePtr->getWidth(),
-        imagePtr->getHeight(),
-        thumbData,
-        thumb_blob->getLength()) < 0) {
-        errorPrint("bp_tab_adaptor_set_snapshot");
-    }
+    m_unsavedThumbs[tabId.get()] = imagePtr;
+    m_encoder.encode(imagePtr, [this, tabId](tools::BrowserImagePtr encoded) {
+        // callback of superseded thumb is not called
+        m_unsavedThumbs.erase(tabId.get());
+        auto thumb_blob = tools::EflTools::getBlob(encoded);
+        if (!thumb_blob) {
+            BROWSER_LOGW("getBlob failed");
+            return;
+        }
+        auto thumbData = std::move((unsigned char*)thumb_blob->getData());
+        if (bp_tab_adaptor_set_snapshot(
+            tabId.get(),
+            encoded->getWidth(),
+            encoded->getHeight(),
+            thumbData,
+            thumb_blob->getLength()) < 0) {
+            errorPrint("bp_tab_adaptor_set_snapshot");
+        }
+    }, tools::ImageEncoder::SNAPSHOT, thumbKey(tabId));
 }
 
 void TabService::saveFaviconDatabase(
@@ -312,34 +363,37 @@ void TabService::saveFaviconDatabase(
     tools::BrowserImagePtr imagePtr)
 {
     BROWSER_LOGD("[%s:%d] tabId: %d", __PRETTY_FUNCTION__, __LINE__, tabId.get());
-    auto favicon_blob = tools::EflTools::getBlobPNG(imagePtr);
-    if (!favicon_blob) {
-        BROWSER_LOGW("getBlobPNG failed");
+    auto url = getTabUrl(tabId);
+    if (!url)
         return;
-    }
-    auto faviconData = std::move((unsigned char*)favicon_blob->getData());
-    if (bp_tab_adaptor_set_icon(
-            tabId.get(),
-            imagePtr->getWidth(),
-            imagePtr->getHeight(),
-            faviconData,
-            favicon_blob->getLength()) < 0)
-        errorPrint("bp_tab_adaptor_set_snapshot");
+    // favicons are shared with other tabs and history items of the host
+    m_unsavedFavicons[tabId.get()] = imagePtr;
+    m_encoder.encode(imagePtr, [this, tabId, url](tools::BrowserImagePtr encoded) {
+        m_unsavedFavicons.erase(tabId.get());
+        storage::FaviconStorage::getInstance().setFavicon(*url, encoded);
+    }, tools::ImageEncoder::FAVICON, faviconKey(tabId));
 }
 
 bool TabService::tabInDatabase(const basic_webengine::TabId& tabId) const
 {
-    char* url;
+    return static_cast<bool>(getTabUrl(tabId));
+}
+
+boost::optional<std::string> TabService::getTabUrl(const basic_webengine::TabId& tabId) const
+{
+    char* url = nullptr;
     int result = bp_tab_adaptor_get_url(tabId.get(), &url);
     if (result == BP_TAB_ERROR_ID_NOT_FOUND) {
         errorPrint("passed the id is not exist in the storage");
-        return false;
+        return boost::none;
     } else if (result < 0) {
         errorPrint("bp_tab_adaptor_get_url");
-        return false;
+        return boost::none;
     }
 
-    return true;
+    std::string tabUrl(tools::fromChar(url));
+    free(url);
+    return tabUrl;
 }
 
 boost::optional<tools::BrowserImagePtr> TabService::getThumbDatabase(
@@ -373,11 +427,17 @@ boost::optional<tools::BrowserImagePtr> TabService::getFaviconDatabase(
     const basic_webengine::TabId& tabId)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
-    if (!tabInDatabase(tabId)) {
+    auto url = getTabUrl(tabId);
+    if (!url) {
         BROWSER_LOGD("no tab in database");
         return boost::none;
     }
 
+    auto stored = storage::FaviconStorage::getInstance().getFavicon(*url);
+    if (stored)
+        return stored;
+
+    // tabs saved before the favicon store keep their favicons in tab database
     int w = 0, h = 0, l = 0;
     unsigned char* v = nullptr;
     if (bp_tab_adaptor_get_icon(tabId.get(), &w, &h, &v, &l)) {
@@ -28,6 +28,8 @@
 #include <web/web_tab.h>
 #include "TabIdTypedef.h"
 #include "BrowserImage.h"
+#include "ImageCache.h"
+#include "ImageEncoder.h"
 #include "AbstractWebEngine/TabOrigin.h"
 
 namespace tizen_browser {
@@ -122,7 +124,7 @@ private:
 
     /**
      * Get image thumb for given id (from cache or database).
-     * Create one, if it does not exist.
+     * If it does not exist, request one and return empty image.
      */
     tools::BrowserImagePtr getThumb(const basic_webengine::TabId& tabId);
 
@@ -175,7 +177,8 @@ private:
     boost::optional<tools::BrowserImagePtr> getThumbDatabase(
             const basic_webengine::TabId& tabId);
     /**
-     * Save given thumb image with given tab id in a database.
+     * Save given thumb image with given tab id in a database. Raw image is
+     * encoded on a worker thread first, newer thumb of the tab supersedes it.
      */
     void saveThumbDatabase(const basic_webengine::TabId& tabId,
             tools::BrowserImagePtr imagePtr);
@@ -183,6 +186,12 @@ private:
      * Check if tab for given id is in a database.
      */
     bool tabInDatabase(const basic_webengine::TabId& tabId) const;
+    /**
+     * Get url of tab for given id from a database.
+     *
+     * @return url or boost::none, when there is no such tab.
+     */
+    boost::optional<std::string> getTabUrl(const basic_webengine::TabId& tabId) const;
     /**
      * Remove image from a database for given tab id.
      *
@@ -198,16 +207,26 @@ private:
     boost::optional<tools::BrowserImagePtr> getFaviconDatabase(
             const basic_webengine::TabId& tabId);
     /**
-     * Save given favicon image with given tab id in a database.
+     * Save given favicon image of the tab's host in the favicon store,
+     * encoded like the thumb.
      */
     void saveFaviconDatabase(const basic_webengine::TabId& tabId,
             tools::BrowserImagePtr imagePtr);
 
     /**
-     * Map caching images. Keys: tab ids, values: thumb images.
+     * Caches of images, keys are tab ids. Limited by memory budgets from
+     * Config, evicted images are read from database again.
+     */
+    ImageCache m_thumbCache;
+    ImageCache m_faviconCache;
+    tools::ImageEncoder m_encoder;
+
+    /**
+     * Images, which are still encoded before their database write, keys are
+     * tab ids. Cache may evict them meanwhile, they are read from here then.
      */
-    std::map<int, tools::BrowserImagePtr> m_thumbMap;
-    std::map<int, tools::BrowserImagePtr> m_faviconMap;
+    std::map<int, tools::BrowserImagePtr> m_unsavedThumbs;
+    std::map<int, tools::BrowserImagePtr> m_unsavedFavicons;
 };
 
 } /* namespace base_ui */
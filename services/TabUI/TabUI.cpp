@@ -428,6 +428,21 @@ void TabUI::addTabItems(std::vector<basic_webengine::TabContentPtr>& items, bool
     updateNoTabsText();
 }
 
+void TabUI::updateTabThumbnail(const basic_webengine::TabId& tabId, tools::BrowserImagePtr thumbnail)
+{
+    BROWSER_LOGD("[%s:%d] tab: %s", __PRETTY_FUNCTION__, __LINE__, tabId.toString().c_str());
+    if (!m_gengrid)
+        return;
+    for (auto it = elm_gengrid_first_item_get(m_gengrid); it; it = elm_gengrid_item_next_get(it)) {
+        auto itemData = static_cast<TabData*>(elm_object_item_data_get(it));
+        if (itemData && itemData->item->getId() == tabId) {
+            itemData->item->setThumbnail(thumbnail);
+            elm_gengrid_item_fields_update(it, "elm.thumbnail", ELM_GENGRID_ITEM_FIELD_CONTENT);
+            return;
+        }
+    }
+}
+
 void TabUI::setStateButtons()
 {
         switch (m_state) {
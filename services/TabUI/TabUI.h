@@ -24,6 +24,7 @@
 #include "AbstractUIComponent.h"
 #include "AbstractService.h"
 #include "AbstractWebEngine/State.h"
+#include "BrowserImage.h"
 #include "ServiceFactory.h"
 #include "service_macros.h"
 #include "TabIdTypedef.h"
@@ -52,6 +53,11 @@ public:
     virtual std::string getName();
 
     void addTabItems(std::vector<basic_webengine::TabContentPtr>& items, bool secret);
+
+    /**
+     * @brief Replaces thumbnail of the tab, if the tab is shown.
+     */
+    void updateTabThumbnail(const basic_webengine::TabId& tabId, tools::BrowserImagePtr thumbnail);
     virtual void orientationChanged() override;
 
     //AbstractContextMenu interface implementation
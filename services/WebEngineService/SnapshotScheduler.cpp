@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "browser_config.h"
+#include "SnapshotScheduler.h"
+
+#include <algorithm>
+
+#include "BrowserLogger.h"
+
+namespace tizen_browser {
+namespace basic_webengine {
+namespace webengine_service {
+
+SnapshotScheduler::SnapshotScheduler(Capture capture, Deliver deliver)
+    : m_capture(capture)
+    , m_deliver(deliver)
+    , m_generation(0)
+{
+}
+
+bool SnapshotScheduler::sameTarget(const Request& request, const TabId& tabId, tools::SnapshotType type)
+{
+    // bookmark snapshots have other size and consumer than tab thumbnails
+    return request.tabId == tabId
+        && (request.type == tools::SnapshotType::ASYNC_BOOKMARK) == (type == tools::SnapshotType::ASYNC_BOOKMARK);
+}
+
+SnapshotScheduler::Requests::iterator SnapshotScheduler::find(Requests& requests, const TabId& tabId,
+    tools::SnapshotType type)
+{
+    return std::find_if(requests.begin(), requests.end(), [&tabId, type](const Request& request) {
+        return sameTarget(request, tabId, type);
+    });
+}
+
+void SnapshotScheduler::request(const TabId& tabId, int width, int height, tools::SnapshotType type)
+{
+    BROWSER_LOGD("[%s:%d] tab: %s", __PRETTY_FUNCTION__, __LINE__, tabId.toString().c_str());
+    if (type == tools::SnapshotType::SYNC) {
+        BROWSER_LOGE("[%s:%d] Synchronized snapshot in asynchronized workflow", __PRETTY_FUNCTION__, __LINE__);
+        return;
+    }
+
+    if (find(m_inFlight, tabId, type) == m_inFlight.end()) {
+        start(Request{tabId, width, height, type, std::string()});
+        return;
+    }
+
+    // page may change until the running capture ends, so it is repeated
+    auto pending = find(m_pending, tabId, type);
+    if (pending == m_pending.end()) {
+        m_pending.push_back(Request{tabId, width, height, type, std::string()});
+        return;
+    }
+    pending->width = width;
+    pending->height = height;
+    if (type == tools::SnapshotType::ASYNC_LOAD_FINISHED)
+        pending->type = type;
+}
+
+void SnapshotScheduler::start(Request request)
+{
+    auto uri = m_capture(request.tabId, request.width, request.height, request.type);
+    if (!uri) {
+        BROWSER_LOGW("[%s:%d] capture of tab %s not started", __PRETTY_FUNCTION__, __LINE__,
+            request.tabId.toString().c_str());
+        return;
+    }
+    request.uri = *uri;
+    m_inFlight.push_back(request);
+}
+
+void SnapshotScheduler::captured(const TabId& tabId, tools::BrowserImagePtr snapshot, tools::SnapshotType type)
+{
+    BROWSER_LOGD("[%s:%d] tab: %s", __PRETTY_FUNCTION__, __LINE__, tabId.toString().c_str());
+    auto inFlight = find(m_inFlight, tabId, type);
+    if (inFlight == m_inFlight.end()) {
+        BROWSER_LOGD("[%s:%d] snapshot not requested or cancelled", __PRETTY_FUNCTION__, __LINE__);
+        return;
+    }
+    Request request(*inFlight);
+    m_inFlight.erase(inFlight);
+
+    const unsigned generation = m_generation;
+    m_encoder.encode(snapshot, [this, generation, request](tools::BrowserImagePtr encoded) {
+        if (generation == m_generation)
+            m_deliver(encoded, request.type, request.tabId, request.uri);
+    });
+
+    auto pending = find(m_pending, tabId, type);
+    if (pending != m_pending.end()) {
+        Request next(*pending);
+        m_pending.erase(pending);
+        start(next);
+    }
+}
+
+void SnapshotScheduler::cancel(const TabId& tabId)
+{
+    auto ofTab = [&tabId](const Request& request) { return request.tabId == tabId; };
+    m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(), ofTab), m_pending.end());
+    m_inFlight.erase(std::remove_if(m_inFlight.begin(), m_inFlight.end(), ofTab), m_inFlight.end());
+}
+
+void SnapshotScheduler::cancelAll()
+{
+    m_pending.clear();
+    m_inFlight.clear();
+    ++m_generation;
+}
+
+bool SnapshotScheduler::isPending(const TabId& tabId) const
+{
+    return std::any_of(m_pending.begin(), m_pending.end(),
+        [&tabId](const Request& request) { return request.tabId == tabId; });
+}
+
+bool SnapshotScheduler::isInFlight(const TabId& tabId) const
+{
+    return std::any_of(m_inFlight.begin(), m_inFlight.end(),
+        [&tabId](const Request& request) { return request.tabId == tabId; });
+}
+
+} /* end of webengine_service */
+} /* end of basic_webengine */
+} /* end of tizen_browser */
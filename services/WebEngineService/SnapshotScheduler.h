@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SNAPSHOTSCHEDULER_H_
+#define SNAPSHOTSCHEDULER_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "AbstractWebEngine/TabId.h"
+#include "BrowserImage.h"
+#include "ImageEncoder.h"
+#include "SnapshotType.h"
+
+namespace tizen_browser {
+namespace basic_webengine {
+namespace webengine_service {
+
+/**
+ * @brief Captures snapshots of tabs without blocking the main loop.
+ *
+ * Snapshots are captured with the asynchronous engine API and encoded on
+ * a worker thread. Only one capture per tab (and kind of snapshot - tab
+ * thumbnail or bookmark) is in flight. Requests made meanwhile are
+ * coalesced into a single capture, started when the running one ends.
+ */
+class SnapshotScheduler
+{
+public:
+    /**
+     * Starts asynchronous capture of the tab, the result has to be passed
+     * to captured(). Returns uri of the captured page or boost::none, if
+     * capture cannot be started.
+     */
+    using Capture = std::function<boost::optional<std::string> (const TabId&, int width, int height,
+            tools::SnapshotType)>;
+    using Deliver = std::function<void (tools::BrowserImagePtr, tools::SnapshotType, const TabId&,
+            const std::string& uri)>;
+
+    SnapshotScheduler(Capture capture, Deliver deliver);
+
+    /**
+     * @brief Requests snapshot of the tab. It is captured at once, unless
+     * a capture of the tab is in flight.
+     *
+     * ASYNC_LOAD_FINISHED and ASYNC_TAB requests of the same tab are merged,
+     * ASYNC_LOAD_FINISHED wins. The last requested size is used.
+     */
+    void request(const TabId& tabId, int width, int height, tools::SnapshotType type);
+
+    /**
+     * @brief Takes result of the capture started by the scheduler. Snapshot
+     * is encoded and delivered, unless the request was cancelled.
+     */
+    void captured(const TabId& tabId, tools::BrowserImagePtr snapshot, tools::SnapshotType type);
+
+    /**
+     * @brief Drops pending and running requests of the tab.
+     */
+    void cancel(const TabId& tabId);
+
+    /**
+     * @brief Drops all requests, snapshots already being encoded included.
+     */
+    void cancelAll();
+
+    bool isPending(const TabId& tabId) const;
+    bool isInFlight(const TabId& tabId) const;
+
+private:
+    struct Request
+    {
+        TabId tabId;
+        int width;
+        int height;
+        tools::SnapshotType type;
+        std::string uri;
+    };
+
+    using Requests = std::vector<Request>;
+
+    static bool sameTarget(const Request& request, const TabId& tabId, tools::SnapshotType type);
+    static Requests::iterator find(Requests& requests, const TabId& tabId, tools::SnapshotType type);
+    void start(Request request);
+
+    Capture m_capture;
+    Deliver m_deliver;
+    Requests m_pending;
+    Requests m_inFlight;
+    // changed by cancelAll(), results of older generations are dropped
+    unsigned m_generation;
+    tools::ImageEncoder m_encoder;
+};
+
+} /* end of webengine_service */
+} /* end of basic_webengine */
+} /* end of tizen_browser */
+
+#endif /* SNAPSHOTSCHEDULER_H_ */
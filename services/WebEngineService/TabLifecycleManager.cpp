@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "browser_config.h"
+#include "TabLifecycleManager.h"
+
+#include <algorithm>
+
+#include "BrowserLogger.h"
+
+namespace tizen_browser {
+namespace basic_webengine {
+namespace webengine_service {
+
+TabLifecycleManager::TabLifecycleManager(std::size_t liveTabsMax)
+    : m_liveTabsMax(std::max<std::size_t>(liveTabsMax, 1))
+{
+}
+
+void TabLifecycleManager::setLiveTabsMax(std::size_t liveTabsMax)
+{
+    m_liveTabsMax = std::max<std::size_t>(liveTabsMax, 1);
+}
+
+void TabLifecycleManager::added(const TabId& tabId)
+{
+    m_states[tabId] = State::SUSPENDED;
+}
+
+void TabLifecycleManager::activated(const TabId& tabId)
+{
+    for (auto& state : m_states)
+        if (state.second == State::ACTIVE)
+            state.second = State::SUSPENDED;
+    m_states[tabId] = State::ACTIVE;
+}
+
+void TabLifecycleManager::discarded(const TabId& tabId)
+{
+    auto state = m_states.find(tabId);
+    if (state == m_states.end())
+        return;
+    if (state->second == State::ACTIVE) {
+        BROWSER_LOGW("[%s:%d] active tab %s cannot be discarded", __PRETTY_FUNCTION__, __LINE__,
+            tabId.toString().c_str());
+        return;
+    }
+    state->second = State::DISCARDED;
+}
+
+void TabLifecycleManager::removed(const TabId& tabId)
+{
+    m_states.erase(tabId);
+}
+
+void TabLifecycleManager::clear()
+{
+    m_states.clear();
+}
+
+TabLifecycleManager::State TabLifecycleManager::getState(const TabId& tabId) const
+{
+    auto state = m_states.find(tabId);
+    return state == m_states.end() ? State::SUSPENDED : state->second;
+}
+
+std::size_t TabLifecycleManager::getLiveTabsCount() const
+{
+    return std::count_if(m_states.begin(), m_states.end(),
+        [](const std::pair<const TabId, State>& state) { return state.second != State::DISCARDED; });
+}
+
+std::vector<TabId> TabLifecycleManager::getSuspendedTabs(const std::vector<TabId>& mostRecentTab) const
+{
+    std::vector<TabId> suspended;
+    for (const auto& state : m_states)
+        if (state.second == State::SUSPENDED
+                && std::find(mostRecentTab.begin(), mostRecentTab.end(), state.first) == mostRecentTab.end())
+            suspended.push_back(state.first);
+    for (const auto& tabId : mostRecentTab)
+        if (getState(tabId) == State::SUSPENDED && m_states.count(tabId))
+            suspended.push_back(tabId);
+    return suspended;
+}
+
+std::vector<TabId> TabLifecycleManager::getTabsOverBudget(const std::vector<TabId>& mostRecentTab) const
+{
+    std::vector<TabId> suspended = getSuspendedTabs(mostRecentTab);
+    const std::size_t liveTabs = getLiveTabsCount();
+    if (liveTabs <= m_liveTabsMax)
+        return std::vector<TabId>();
+    const std::size_t overBudget = std::min(liveTabs - m_liveTabsMax, suspended.size());
+    return std::vector<TabId>(suspended.begin(), suspended.begin() + overBudget);
+}
+
+} /* end of webengine_service */
+} /* end of basic_webengine */
+} /* end of tizen_browser */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TABLIFECYCLEMANAGER_H_
+#define TABLIFECYCLEMANAGER_H_
+
+#include <map>
+#include <vector>
+
+#include "AbstractWebEngine/TabId.h"
+
+namespace tizen_browser {
+namespace basic_webengine {
+namespace webengine_service {
+
+/**
+ * @brief Keeps lifecycle states of tabs and decides, which of them are
+ * discarded.
+ *
+ * The current tab is ACTIVE, other tabs with a web view are SUSPENDED.
+ * DISCARDED tabs have no web view (and renderer process), they are
+ * recreated, when they become active again. Only the given number of tabs
+ * is kept alive, least recently used tabs are discarded first.
+ */
+class TabLifecycleManager
+{
+public:
+    enum class State {
+        ACTIVE,
+        SUSPENDED,
+        DISCARDED
+    };
+
+    explicit TabLifecycleManager(std::size_t liveTabsMax = 1);
+
+    /**
+     * @brief Sets number of tabs with a web view, the active one included.
+     * At least one tab is always alive.
+     */
+    void setLiveTabsMax(std::size_t liveTabsMax);
+    std::size_t getLiveTabsMax() const { return m_liveTabsMax; }
+
+    void added(const TabId& tabId);
+    void activated(const TabId& tabId);
+    void discarded(const TabId& tabId);
+    void removed(const TabId& tabId);
+    void clear();
+
+    /// state of the tab, SUSPENDED if the tab is unknown
+    State getState(const TabId& tabId) const;
+    std::size_t getLiveTabsCount() const;
+
+    /**
+     * @brief Returns suspended tabs, which exceed the live tabs budget,
+     * least recently used first.
+     *
+     * @param mostRecentTab tabs in order of use, the most recent last.
+     * Tabs missing there were never shown and are discarded first.
+     */
+    std::vector<TabId> getTabsOverBudget(const std::vector<TabId>& mostRecentTab) const;
+
+    /**
+     * @brief Returns all suspended tabs, least recently used first. They
+     * are discarded, when the system is low on memory.
+     */
+    std::vector<TabId> getSuspendedTabs(const std::vector<TabId>& mostRecentTab) const;
+
+private:
+    std::map<TabId, State> m_states;
+    std::size_t m_liveTabsMax;
+};
+
+} /* end of webengine_service */
+} /* end of basic_webengine */
+} /* end of tizen_browser */
+
+#endif /* TABLIFECYCLEMANAGER_H_ */
@@ -17,6 +17,7 @@
 #include "browser_config.h"
 #include "WebEngineService.h"
 
+#include <algorithm>
 #include <Evas.h>
 #include <memory>
 #include <BrowserImage.h>
@@ -38,6 +39,9 @@ namespace webengine_service {
 
 EXPORT_SERVICE(WebEngineService, "org.tizen.browser.webengineservice")
 
+// the active tab and the tab, which it was opened from
+const int LIVE_TABS_MIN = 2;
+
 WebEngineService::WebEngineService()
     : m_state(State::NORMAL)
     , m_initialised(false)
@@ -50,6 +54,23 @@ WebEngineService::WebEngineService()
     , m_signalsConnected(false)
     , m_downloadControl(nullptr)
     , m_defaultContext(ewk_context_default_get())
+    , m_snapshotScheduler(
+        [this](const TabId& id, int width, int height, tools::SnapshotType snapshot_type) {
+            return startSnapshotCapture(id, width, height, snapshot_type);
+        },
+        [this](tools::BrowserImagePtr snapshot, tools::SnapshotType snapshot_type, const TabId& id,
+                const std::string& uri) {
+            deliverSnapshot(snapshot, snapshot_type, id, uri);
+        })
+    , m_lowMemoryHandler(nullptr)
+    , m_webViewPool([this](bool secret) {
+            // mobile mode, as tabs are opened mostly
+            auto webView = std::make_shared<WebView>(m_guiParent, TabId(TabId::NONE), std::string(), secret);
+            webView->init(false, TabOrigin::UNKNOWN);
+            webView->suspend();
+            return webView;
+        })
+    , m_trimTabsJob(nullptr)
 {
     m_stateStruct->mostRecentTab.clear();
     m_stateStruct->tabs.clear();
@@ -64,18 +85,30 @@ WebEngineService::WebEngineService()
     m_settings[WebEngineSettings::AUTOFILL_PROFILE_DATA] = boost::any_cast<bool>(tizen_browser::config::Config::getInstance().get(CONFIG_KEY::WEB_ENGINE_AUTOFILL_PROFILE_DATA));
     m_settings[WebEngineSettings::SCRIPTS_CAN_OPEN_PAGES] = boost::any_cast<bool>(tizen_browser::config::Config::getInstance().get(CONFIG_KEY::WEB_ENGINE_SCRIPTS_CAN_OPEN_PAGES));
 
+    const int liveTabsMax = std::max(LIVE_TABS_MIN,
+        boost::any_cast<int>(tizen_browser::config::Config::getInstance().get(CONFIG_KEY::WEB_ENGINE_LIVE_TABS_MAX)));
+    m_normalStateStruct.lifecycle.setLiveTabsMax(liveTabsMax);
+    m_secretStateStruct.lifecycle.setLiveTabsMax(liveTabsMax);
+    m_webViewPool.setSize(boost::any_cast<int>(tizen_browser::config::Config::getInstance().get(CONFIG_KEY::WEB_ENGINE_WEBVIEW_POOL_SIZE)));
+
     preinitializeWebViewCache();
 }
 
 WebEngineService::~WebEngineService()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    if (m_lowMemoryHandler)
+        ui_app_remove_event_handler(m_lowMemoryHandler);
+    if (m_trimTabsJob)
+        ecore_job_del(m_trimTabsJob);
 }
 
 void WebEngineService::destroyTabs()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    m_snapshotScheduler.cancelAll();
     m_stateStruct->tabs.clear();
+    m_stateStruct->lifecycle.clear();
     if (m_currentWebView)
         m_currentWebView.reset();
 }
@@ -109,6 +142,9 @@ void WebEngineService::init(Evas_Object* guiParent)
     if (!m_initialised) {
         m_guiParent = guiParent;
         m_initialised = true;
+        if (ui_app_add_event_handler(&m_lowMemoryHandler, APP_EVENT_LOW_MEMORY, _lowMemory, this) != APP_ERROR_NONE)
+            BROWSER_LOGW("[%s:%d] low memory handler not added", __PRETTY_FUNCTION__, __LINE__);
+        m_webViewPool.fill(false);
     }
 }
 
@@ -158,7 +194,6 @@ void WebEngineService::connectSignals(std::shared_ptr<WebView> webView)
     webView->backwardEnableChanged.connect(boost::bind(&WebEngineService::_backwardEnableChanged, this, _1));
     webView->confirmationRequest.connect(boost::bind(&WebEngineService::_confirmationRequest, this, _1));
     webView->IMEStateChanged.connect(boost::bind(&WebEngineService::_IMEStateChanged, this, _1));
-    webView->snapshotCaptured.connect(boost::bind(&WebEngineService::_snapshotCaptured, this, _1, _2));
     webView->redirectedWebPage.connect(boost::bind(&WebEngineService::_redirectedWebPage, this, _1, _2));
     webView->setCertificatePem.connect(boost::bind(&WebEngineService::_setCertificatePem, this, _1, _2));
     webView->setWrongCertificatePem.connect(boost::bind(&WebEngineService::_setWrongCertificatePem, this, _1, _2));
@@ -495,6 +530,27 @@ TabId WebEngineService::addTab(
     const std::string& title,
     bool desktopMode,
     TabOrigin origin)
+{
+    return createTab(uri, tabId, title, desktopMode, origin, false);
+}
+
+TabId WebEngineService::addDiscardedTab(
+    const std::string & uri,
+    const boost::optional<int> tabId,
+    const std::string& title,
+    bool desktopMode,
+    TabOrigin origin)
+{
+    return createTab(uri, tabId, title, desktopMode, origin, true);
+}
+
+TabId WebEngineService::createTab(
+    const std::string & uri,
+    const boost::optional<int> tabId,
+    const std::string& title,
+    bool desktopMode,
+    TabOrigin origin,
+    bool discarded)
 {
     if (!(*AbstractWebEngine::checkIfCreate()))
         return currentTabId();
@@ -522,18 +578,42 @@ TabId WebEngineService::addTab(
         initializeDownloadControl();
         m_webViewCacheInitialized = true;
     }
-    WebViewPtr p = std::make_shared<WebView>(m_guiParent, newTabId, title, m_state == State::SECRET);
-    p->init(desktopMode, origin);
+    WebViewPtr p;
+    if (!discarded) {
+        p = m_webViewPool.take(m_state == State::SECRET);
+        // pool is stopped on low memory, it is filled again, when tabs are opened
+        m_webViewPool.fill(m_state == State::SECRET);
+    }
+    if (p) {
+        p->assignTab(newTabId, title, desktopMode, origin);
+        p->resume();
+    } else {
+        p = std::make_shared<WebView>(m_guiParent, newTabId, title, m_state == State::SECRET);
+        if (discarded)
+            p->initDiscarded(desktopMode, origin, uri);
+        else
+            p->init(desktopMode, origin);
+    }
 
-    if (m_state == State::SECRET)
+    if (m_state == State::SECRET && !discarded)
         initializeDownloadControl(p->getContext());
 
     m_stateStruct->tabs[newTabId] = p;
-
-    setWebViewSettings(p);
-
-    if (!uri.empty()) {
-        p->setURI(uri);
+    m_stateStruct->lifecycle.added(newTabId);
+    // tabs in background are captured too, so they are connected for good
+    p->snapshotCaptured.connect(boost::bind(&SnapshotScheduler::captured, &m_snapshotScheduler, newTabId, _1, _2));
+    p->loadFinished.connect(boost::bind(&WebEngineService::_tabLoadFinished, this, newTabId));
+
+    if (discarded) {
+        // view is created and gets its settings, when the tab is switched to;
+        // the tab takes its place in use order, as if it was shown already
+        m_stateStruct->lifecycle.discarded(newTabId);
+        m_stateStruct->mostRecentTab.push_back(newTabId);
+    } else {
+        setWebViewSettings(p);
+        if (!uri.empty()) {
+            p->setURI(uri);
+        }
     }
 
     AbstractWebEngine::tabCreated();
@@ -558,12 +638,26 @@ bool WebEngineService::switchToTab(tizen_browser::basic_webengine::TabId newTabI
     }
 
     if (newTabId != m_stateStruct->currentTabId) {
+        // thumbnail of the tab going to background, captured while it is still visible
+        if (m_stateStruct->tabs.find(m_stateStruct->currentTabId) != m_stateStruct->tabs.end())
+            requestSnapshot(m_stateStruct->currentTabId,
+                boost::any_cast<int>(config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_WIDTH)),
+                boost::any_cast<int>(config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_HEIGHT)),
+                tools::SnapshotType::ASYNC_TAB);
+
         // if there was any running WebView
         if (m_currentWebView)
             suspend();
 
         closeFindOnPage();
         m_currentWebView = m_stateStruct->tabs[newTabId];
+        if (m_currentWebView->isDiscarded()) {
+            BROWSER_LOGD("[%s:%d] restoring discarded tab", __PRETTY_FUNCTION__, __LINE__);
+            m_currentWebView->restore();
+            if (m_state == State::SECRET)
+                initializeDownloadControl(m_currentWebView->getContext());
+            setWebViewSettings(m_currentWebView);
+        }
         m_stateStruct->currentTabId = newTabId;
         m_stateStruct->mostRecentTab.erase(
             std::remove(m_stateStruct->mostRecentTab.begin(),
@@ -571,6 +665,8 @@ bool WebEngineService::switchToTab(tizen_browser::basic_webengine::TabId newTabI
                 newTabId),
             m_stateStruct->mostRecentTab.end());
         m_stateStruct->mostRecentTab.push_back(newTabId);
+        m_stateStruct->lifecycle.activated(newTabId);
+        scheduleTrimTabs();
     }
     resume();
 
@@ -597,7 +693,9 @@ bool WebEngineService::closeTab(TabId id) {
     if (closingTabId == TabId::NONE){
         return res;
     }
+    m_snapshotScheduler.cancel(closingTabId);
     m_stateStruct->tabs.erase(closingTabId);
+    m_stateStruct->lifecycle.removed(closingTabId);
     m_stateStruct->mostRecentTab.erase(
         std::remove(m_stateStruct->mostRecentTab.begin(),
             m_stateStruct->mostRecentTab.end(),
@@ -626,7 +724,8 @@ void WebEngineService::confirmationResult(WebConfirmationPtr c)
     M_ASSERT(c && c->getTabId() != TabId());
 
     // check if still exists
-    if (m_stateStruct->tabs.find(c->getTabId()) == m_stateStruct->tabs.end()) {
+    if (m_stateStruct->tabs.find(c->getTabId()) == m_stateStruct->tabs.end()
+            || m_stateStruct->tabs[c->getTabId()]->isDiscarded()) {
         return;
     }
 
@@ -644,7 +743,8 @@ std::shared_ptr<tizen_browser::tools::BrowserImage> WebEngineService::getSnapsho
 {
     M_ASSERT(m_currentWebView);
     if (m_currentWebView)
-        return m_currentWebView->captureSnapshot(width, height, snapshot_type != tools::SnapshotType::SYNC, snapshot_type);
+        return getSnapshotData(m_stateStruct->currentTabId, width, height,
+            snapshot_type != tools::SnapshotType::SYNC, snapshot_type);
     else
         return std::make_shared<tizen_browser::tools::BrowserImage>();
 }
@@ -655,9 +755,41 @@ std::shared_ptr<tizen_browser::tools::BrowserImage> WebEngineService::getSnapsho
         BROWSER_LOGW("[%s:%d] there is no tab of id %d", __PRETTY_FUNCTION__, __LINE__, id.get());
         return std::shared_ptr<tizen_browser::tools::BrowserImage>();
     }
+    if (async) {
+        requestSnapshot(id, width, height, snapshot_type);
+        return std::make_shared<tizen_browser::tools::BrowserImage>();
+    }
    return m_stateStruct->tabs[id]->captureSnapshot(width, height, async, snapshot_type);
 }
 
+void WebEngineService::requestSnapshot(TabId id, int width, int height, tizen_browser::tools::SnapshotType snapshot_type)
+{
+    BROWSER_LOGD("[%s:%d] tab: %s", __PRETTY_FUNCTION__, __LINE__, id.toString().c_str());
+    m_snapshotScheduler.request(id, width, height, snapshot_type);
+}
+
+boost::optional<std::string> WebEngineService::startSnapshotCapture(const TabId& id, int width, int height,
+        tools::SnapshotType snapshot_type)
+{
+    auto tab = m_stateStruct->tabs.find(id);
+    if (tab == m_stateStruct->tabs.end()) {
+        BROWSER_LOGW("[%s:%d] there is no tab of id %d", __PRETTY_FUNCTION__, __LINE__, id.get());
+        return boost::none;
+    }
+    if (!tab->second->captureSnapshotAsync(width, height, snapshot_type))
+        return boost::none;
+    return tab->second->getURI();
+}
+
+void WebEngineService::deliverSnapshot(tools::BrowserImagePtr snapshot, tools::SnapshotType snapshot_type,
+        const TabId& id, const std::string& uri)
+{
+    // tab could be closed, while the snapshot was encoded
+    if (m_stateStruct->tabs.find(id) == m_stateStruct->tabs.end())
+        return;
+    snapshotCaptured(snapshot, snapshot_type, id, uri);
+}
+
 void WebEngineService::setFocus()
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
@@ -754,28 +886,32 @@ void WebEngineService::setZoomFactor(int zoomFactor)
 void WebEngineService::clearCache()
 {
     for(const auto& it: m_stateStruct->tabs) {
-        it.second->clearCache();
+        if (!it.second->isDiscarded())
+            it.second->clearCache();
     }
 }
 
 void WebEngineService::clearCookies()
 {
     for(const auto& it: m_stateStruct->tabs) {
-        it.second->clearCookies();
+        if (!it.second->isDiscarded())
+            it.second->clearCookies();
     }
 }
 
 void WebEngineService::clearPrivateData()
 {
     for(const auto& it: m_stateStruct->tabs) {
-        it.second->clearPrivateData();
+        if (!it.second->isDiscarded())
+            it.second->clearPrivateData();
     }
 }
 
 void WebEngineService::clearPasswordData()
 {
     for(const auto& it: m_stateStruct->tabs) {
-        it.second->clearPasswordData();
+        if (!it.second->isDiscarded())
+            it.second->clearPasswordData();
     }
 }
 
@@ -793,7 +929,8 @@ void WebEngineService::clearFormData()
     }
     ewk_context_form_candidate_data_delete_all(m_defaultContext);
     for(const auto& it: m_stateStruct->tabs)
-        it.second->clearFormData();
+        if (!it.second->isDiscarded())
+            it.second->clearFormData();
 }
 
 void WebEngineService::searchOnWebsite(const std::string & searchString, int flags)
@@ -812,9 +949,58 @@ void WebEngineService::_IMEStateChanged(bool enable)
     IMEStateChanged(enable);
 }
 
-void WebEngineService::_snapshotCaptured(std::shared_ptr<tizen_browser::tools::BrowserImage> image, tools::SnapshotType snapshot_type)
+void WebEngineService::_tabLoadFinished(TabId id)
+{
+    BROWSER_LOGD("[%s:%d] tab: %s", __PRETTY_FUNCTION__, __LINE__, id.toString().c_str());
+    requestSnapshot(id,
+        boost::any_cast<int>(config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_WIDTH)),
+        boost::any_cast<int>(config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_HEIGHT)),
+        tools::SnapshotType::ASYNC_LOAD_FINISHED);
+}
+
+void WebEngineService::discardTab(StateStruct& stateStruct, const TabId& id)
+{
+    auto tab = stateStruct.tabs.find(id);
+    if (tab == stateStruct.tabs.end() || tab->second->isDiscarded() || id == stateStruct.currentTabId)
+        return;
+    BROWSER_LOGD("[%s:%d] discarding tab: %s", __PRETTY_FUNCTION__, __LINE__, id.toString().c_str());
+
+    m_snapshotScheduler.cancel(id);
+    tab->second->discard();
+    stateStruct.lifecycle.discarded(id);
+    tabDiscarded(std::make_shared<TabContent>(id, tab->second->getURI(), tab->second->getTitle(),
+        tab->second->getOrigin(), &stateStruct == &m_secretStateStruct));
+}
+
+void WebEngineService::trimTabs()
 {
-    snapshotCaptured(image, snapshot_type);
+    for (const auto& id : m_stateStruct->lifecycle.getTabsOverBudget(m_stateStruct->mostRecentTab))
+        discardTab(*m_stateStruct, id);
+}
+
+void WebEngineService::scheduleTrimTabs()
+{
+    if (!m_trimTabsJob)
+        m_trimTabsJob = ecore_job_add(_trimTabs, this);
+}
+
+void WebEngineService::_trimTabs(void* data)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    auto self = static_cast<WebEngineService*>(data);
+    self->m_trimTabsJob = nullptr;
+    self->trimTabs();
+}
+
+void WebEngineService::_lowMemory(app_event_info_h, void* data)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    auto self = static_cast<WebEngineService*>(data);
+    self->m_webViewPool.clearAll();
+    // only current tabs of both states are kept
+    for (auto stateStruct : {&self->m_normalStateStruct, &self->m_secretStateStruct})
+        for (const auto& id : stateStruct->lifecycle.getSuspendedTabs(stateStruct->mostRecentTab))
+            self->discardTab(*stateStruct, id);
 }
 
 void WebEngineService::_redirectedWebPage(const std::string& oldUrl, const std::string& newUrl)
@@ -964,6 +1150,9 @@ bool WebEngineService::getSettingsParam(WebEngineSettings param) {
 void WebEngineService::setSettingsParam(WebEngineSettings param, bool value) {
     m_settings[param] = value;
     for(auto it = m_stateStruct->tabs.cbegin(); it != m_stateStruct->tabs.cend(); ++it) {
+        // restored tabs get all settings again
+        if (it->second->isDiscarded())
+            continue;
         switch (param) {
         case WebEngineSettings::PAGE_OVERVIEW:
             it->second->ewkSettingsAutoFittingSet(value);
@@ -1018,13 +1207,17 @@ void WebEngineService::resetSettingsParam()
 void WebEngineService::changeState()
 {
     suspend();
+    // snapshots are saved according to the state they are delivered in
+    m_snapshotScheduler.cancelAll();
 
     if (m_state == State::NORMAL) {
         m_state = State::SECRET;
         m_stateStruct = &m_secretStateStruct;
+        m_webViewPool.fill(true);
     } else {
         m_state = State::NORMAL;
         m_stateStruct = &m_normalStateStruct;
+        m_webViewPool.clear(true);
     }
 
     if (m_stateStruct->tabs.empty())
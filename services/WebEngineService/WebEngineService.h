@@ -19,9 +19,11 @@
 
 #include <boost/noncopyable.hpp>
 #include <string>
+#include <Ecore.h>
 #include <Evas.h>
 #include <memory>
 #include <EWebKit_internal.h>
+#include <app.h>
 
 #include "service_macros.h"
 
@@ -29,6 +31,9 @@
 #include "AbstractWebEngine/TabIdTypedef.h"
 #include "AbstractWebEngine/State.h"
 #include "SnapshotType.h"
+#include "SnapshotScheduler.h"
+#include "TabLifecycleManager.h"
+#include "WebViewPool.h"
 
 class DownloadControl;
 
@@ -115,6 +120,17 @@ public:
             const std::string& title = std::string(),
             bool desktopMode = true,
             TabOrigin origin = TabOrigin::UNKNOWN);
+
+    /**
+     * See AbstractWebEngine@addDiscardedTab(const std::string&,
+     * const boost::optional<int>, const std::string&, bool, TabOrigin)
+     */
+    TabId addDiscardedTab(
+            const std::string & uri,
+            const boost::optional<int> tabId,
+            const std::string& title,
+            bool desktopMode = true,
+            TabOrigin origin = TabOrigin::UNKNOWN);
     Evas_Object* getTabView(TabId id);
     bool switchToTab(TabId);
     bool closeTab();
@@ -133,6 +149,12 @@ public:
 
     std::shared_ptr<tizen_browser::tools::BrowserImage> getSnapshotData(TabId id, int width, int height, bool async, tizen_browser::tools::SnapshotType snapshot_type);
 
+    /**
+     * @brief Request asynchronous snapshot of the tab, see
+     * AbstractWebEngine::requestSnapshot
+     */
+    void requestSnapshot(TabId id, int width, int height, tizen_browser::tools::SnapshotType snapshot_type) override;
+
     /**
      * @brief Get the state of secret mode
      *
@@ -243,7 +265,7 @@ private:
     void _loadProgress(double);
     void _confirmationRequest(WebConfirmationPtr) ;
     void _IMEStateChanged(bool);
-    void _snapshotCaptured(std::shared_ptr<tizen_browser::tools::BrowserImage> snapshot, tools::SnapshotType snapshot_type);
+    void _tabLoadFinished(TabId id);
     void _redirectedWebPage(const std::string& oldUrl, const std::string& newUrl);
     void _setCertificatePem(const std::string& uri, const std::string& pem);
     void _setWrongCertificatePem(const std::string& uri, const std::string& pem);
@@ -269,13 +291,51 @@ private:
     int createTabId();
     void initializeDownloadControl(Ewk_Context* context = ewk_context_default_get());
 
+    static void _lowMemory(app_event_info_h event_info, void* data);
+    static void _trimTabs(void* data);
+
+    // SnapshotScheduler callbacks
+    boost::optional<std::string> startSnapshotCapture(const TabId& id, int width, int height,
+            tools::SnapshotType snapshot_type);
+    void deliverSnapshot(tools::BrowserImagePtr snapshot, tools::SnapshotType snapshot_type,
+            const TabId& id, const std::string& uri);
+
 private:
     struct StateStruct {
         std::map<TabId, WebViewPtr > tabs;
         std::vector<TabId> mostRecentTab;
         TabId currentTabId = TabId::NONE;
+        TabLifecycleManager lifecycle;
     };
 
+    /**
+     * Adds the tab, its web view is created now or, if discarded, when the
+     * tab is switched to.
+     */
+    TabId createTab(
+            const std::string & uri,
+            const boost::optional<int> tabId,
+            const std::string& title,
+            bool desktopMode,
+            TabOrigin origin,
+            bool discarded);
+
+    /**
+     * Destroys web view of the background tab, see WebView::discard
+     */
+    void discardTab(StateStruct& stateStruct, const TabId& id);
+
+    /**
+     * Discards least recently used tabs, which exceed the live tabs budget
+     */
+    void trimTabs();
+
+    /**
+     * Calls trimTabs() from the main loop. Tab may be switched from a
+     * callback of the web view, which would be discarded.
+     */
+    void scheduleTrimTabs();
+
     State m_state;
     bool m_initialised;
     Evas_Object* m_guiParent;
@@ -294,6 +354,10 @@ private:
     std::map<WebEngineSettings, bool>  m_settings;
     std::shared_ptr<DownloadControl> m_downloadControl;
     Ewk_Context* m_defaultContext;
+    SnapshotScheduler m_snapshotScheduler;
+    app_event_handler_h m_lowMemoryHandler;
+    WebViewPool m_webViewPool;
+    Ecore_Job* m_trimTabsJob;
 };
 
 } /* end of webengine_service */
@@ -23,6 +23,8 @@
 
 #include "WebView.h"
 
+#include <algorithm>
+#include <memory>
 #include <EWebKit.h>
 
 #include <boost/format.hpp>
@@ -36,7 +38,6 @@
 #include "app_i18n.h"
 #include "AbstractWebEngine/AbstractWebEngine.h"
 #include "AbstractWebEngine/TabOrigin.h"
-#include "Config.h"
 #include "DownloadControl/DownloadControl.h"
 #include "app_common.h"
 #include "BrowserAssert.h"
@@ -101,6 +102,10 @@ WebView::WebView(Evas_Object * obj, TabId tabId, const std::string& title, bool
     , m_isLoading(false)
     , m_loadError(false)
     , m_suspended(false)
+    , m_discarded(false)
+    , m_discardedScrollX(0)
+    , m_discardedScrollY(0)
+    , m_restoreScroll(false)
     , m_private(incognitoMode)
     , m_fullscreen(false)
     , m_downloadControl(nullptr)
@@ -116,6 +121,8 @@ WebView::~WebView()
         evas_object_del(m_ewkView);
     }
     delete m_downloadControl;
+    for (auto snapshot_data : m_snapshotRequests)
+        snapshot_data->web_view = nullptr;
 }
 
 void WebView::init(bool desktopMode, TabOrigin origin)
@@ -660,6 +667,8 @@ void WebView::setURI(const std::string & uri)
 
 std::string WebView::getURI(void)
 {
+    if (m_discarded)
+        return m_discardedURI;
     BROWSER_LOGD("[%s:%d] uri=%s", __PRETTY_FUNCTION__, __LINE__, ewk_view_url_get(m_ewkView));
     return fromChar(ewk_view_url_get(m_ewkView));
 }
@@ -840,6 +849,76 @@ void WebView::resume()
     m_suspended = false;
 }
 
+void WebView::discard()
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    if (m_discarded || !m_ewkView)
+        return;
+
+    m_discardedURI = getURI();
+    ewk_view_scroll_pos_get(m_ewkView, &m_discardedScrollX, &m_discardedScrollY);
+    m_restoreScroll = false;
+
+    // captures of the destroyed view are never delivered
+    for (auto snapshot_data : m_snapshotRequests)
+        snapshot_data->web_view = nullptr;
+    m_snapshotRequests.clear();
+
+    unregisterCallbacks();
+    evas_object_del(m_ewkView);
+    m_ewkView = nullptr;
+    m_ewkContext = nullptr;
+    delete m_downloadControl;
+    m_downloadControl = nullptr;
+    m_isLoading = false;
+    m_suspended = true;
+    m_discarded = true;
+}
+
+void WebView::restore()
+{
+    BROWSER_LOGD("[%s:%d] uri=%s", __PRETTY_FUNCTION__, __LINE__, m_discardedURI.c_str());
+    if (!m_discarded)
+        return;
+
+    m_discarded = false;
+    init(m_desktopMode, m_origin);
+    if (!m_discardedURI.empty()) {
+        m_restoreScroll = m_discardedScrollX || m_discardedScrollY;
+        setURI(m_discardedURI);
+    }
+}
+
+void WebView::initDiscarded(bool desktopMode, TabOrigin origin, const std::string& uri)
+{
+    BROWSER_LOGD("[%s:%d] uri=%s", __PRETTY_FUNCTION__, __LINE__, uri.c_str());
+    M_ASSERT(!m_ewkView);
+
+    m_desktopMode = desktopMode;
+    m_origin = origin;
+    m_discardedURI = uri;
+    m_discardedScrollX = 0;
+    m_discardedScrollY = 0;
+    m_suspended = true;
+    m_discarded = true;
+}
+
+void WebView::assignTab(const TabId& tabId, const std::string& title, bool desktopMode, TabOrigin origin)
+{
+    BROWSER_LOGD("[%s:%d] tab: %s", __PRETTY_FUNCTION__, __LINE__, tabId.toString().c_str());
+    M_ASSERT(m_ewkView);
+
+    m_tabId = tabId;
+    m_title = title;
+    m_origin = origin;
+    if (desktopMode != m_desktopMode) {
+        if (desktopMode)
+            switchToDesktopMode();
+        else
+            switchToMobileMode();
+    }
+}
+
 void WebView::stopLoading(void)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
@@ -926,19 +1005,17 @@ void WebView::confirmationResult(WebConfirmationPtr confirmation)
     }
 }
 
-tools::BrowserImagePtr WebView::captureSnapshot(int targetWidth, int targetHeight, bool async,
-        tizen_browser::tools::SnapshotType snapshot_type)
+bool WebView::getSnapshotArea(int targetWidth, int targetHeight, Eina_Rectangle& area, double& scale)
 {
-    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     M_ASSERT(m_ewkView);
     M_ASSERT(targetWidth);
     M_ASSERT(targetHeight);
     Evas_Coord vw, vh;
     evas_object_geometry_get(m_ewkView, nullptr, nullptr, &vw, &vh);
     if (vw == 0 || vh == 0)
-        return std::make_shared<BrowserImage>();
+        return false;
 
-    double scale = targetWidth / (double)(vw * getZoomFactor());
+    scale = targetWidth / (double)(vw * getZoomFactor());
     double scale_max, scale_min;
     ewk_view_scale_range_get(m_ewkView, &scale_min, &scale_max);
     if (scale < scale_min)
@@ -946,7 +1023,6 @@ tools::BrowserImagePtr WebView::captureSnapshot(int targetWidth, int targetHeigh
     else if (scale > scale_max)
         scale = scale_max;
 
-    Eina_Rectangle area;
     double snapshotProportions = (double)(targetWidth) /(double)(targetHeight);
     double webkitProportions = (double)(vw) /(double)(vh);
     if (webkitProportions >= snapshotProportions) {
@@ -962,34 +1038,68 @@ tools::BrowserImagePtr WebView::captureSnapshot(int targetWidth, int targetHeigh
         area.w = vw*getZoomFactor();
         area.h = vw*getZoomFactor()/snapshotProportions;
     }
-    if (area.w == 0 || area.h == 0)
-        return std::make_shared<BrowserImage>();
-
-    BROWSER_LOGD("[%s:%d] Before snapshot (screenshot) - look at the time of taking snapshot below",__func__, __LINE__);
+    return area.w != 0 && area.h != 0;
+}
 
+tools::BrowserImagePtr WebView::captureSnapshot(int targetWidth, int targetHeight, bool async,
+        tizen_browser::tools::SnapshotType snapshot_type)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
     if (async) {
-        SnapshotItemData *snapshot_data = new SnapshotItemData();
-        snapshot_data->web_view = this;
-        snapshot_data->snapshot_type = snapshot_type;
-        bool result = ewk_view_screenshot_contents_get_async(m_ewkView, area, scale, evas_object_evas_get(m_ewkView), __screenshotCaptured, snapshot_data);
-        if (!result)
-            BROWSER_LOGD("[%s:%d] ewk_view_screenshot_contents_get_async API failed", __func__, __LINE__);
-    } else {
-        Evas_Object *snapshot = ewk_view_screenshot_contents_get(m_ewkView, area, scale, evas_object_evas_get(m_ewkView));
-        BROWSER_LOGD("[%s:%d] Snapshot (screenshot) catched, evas pointer: %p",__func__, __LINE__, snapshot);
-        if (snapshot)
-            return std::make_shared<tools::BrowserImage>(snapshot);
+        captureSnapshotAsync(targetWidth, targetHeight, snapshot_type);
+        return std::make_shared<BrowserImage>();
     }
 
+    Eina_Rectangle area;
+    double scale;
+    if (m_discarded || !getSnapshotArea(targetWidth, targetHeight, area, scale))
+        return std::make_shared<BrowserImage>();
+
+    BROWSER_LOGD("[%s:%d] Before snapshot (screenshot) - look at the time of taking snapshot below",__func__, __LINE__);
+    Evas_Object *snapshot = ewk_view_screenshot_contents_get(m_ewkView, area, scale, evas_object_evas_get(m_ewkView));
+    BROWSER_LOGD("[%s:%d] Snapshot (screenshot) catched, evas pointer: %p",__func__, __LINE__, snapshot);
+    if (snapshot)
+        return std::make_shared<tools::BrowserImage>(snapshot);
+
     return std::make_shared<BrowserImage>();
 }
 
+bool WebView::captureSnapshotAsync(int targetWidth, int targetHeight, tizen_browser::tools::SnapshotType snapshot_type)
+{
+    BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
+    Eina_Rectangle area;
+    double scale;
+    if (m_discarded || !getSnapshotArea(targetWidth, targetHeight, area, scale))
+        return false;
+
+    // engine scales the snapshot and renders it outside of the main loop
+    SnapshotItemData *snapshot_data = new SnapshotItemData();
+    snapshot_data->web_view = this;
+    snapshot_data->snapshot_type = snapshot_type;
+    if (!ewk_view_screenshot_contents_get_async(m_ewkView, area, scale, evas_object_evas_get(m_ewkView),
+            __screenshotCaptured, snapshot_data)) {
+        BROWSER_LOGD("[%s:%d] ewk_view_screenshot_contents_get_async API failed", __func__, __LINE__);
+        delete snapshot_data;
+        return false;
+    }
+    m_snapshotRequests.push_back(snapshot_data);
+    return true;
+}
+
 void WebView::__screenshotCaptured(Evas_Object* image, void* data)
 {
     BROWSER_LOGD("[%s:%d] ", __PRETTY_FUNCTION__, __LINE__);
 
-    SnapshotItemData *snapshot_data = static_cast<SnapshotItemData*>(data);
-    snapshot_data->web_view->snapshotCaptured(std::make_shared<tools::BrowserImage>(image), snapshot_data->snapshot_type);
+    std::unique_ptr<SnapshotItemData> snapshot_data(static_cast<SnapshotItemData*>(data));
+    WebView* self = snapshot_data->web_view;
+    // web view was destroyed before capture finished
+    if (!self)
+        return;
+
+    auto& requests = self->m_snapshotRequests;
+    requests.erase(std::remove(requests.begin(), requests.end(), snapshot_data.get()), requests.end());
+    auto snapshot = image ? std::make_shared<tools::BrowserImage>(image) : std::make_shared<tools::BrowserImage>();
+    self->snapshotCaptured(snapshot, snapshot_data->snapshot_type);
 }
 
 void WebView::__newWindowRequest(void *data, Evas_Object *, void *out)
@@ -1055,12 +1165,13 @@ void WebView::__loadFinished(void * data, Evas_Object * /* obj */, void * /* eve
     self->m_isLoading = false;
     self->m_loadProgress = 1;
 
+    if (self->m_restoreScroll) {
+        self->m_restoreScroll = false;
+        ewk_view_scroll_set(self->m_ewkView, self->m_discardedScrollX, self->m_discardedScrollY);
+    }
+
     self->loadFinished();
     self->loadProgress(self->m_loadProgress);
-
-    self->captureSnapshot(boost::any_cast<int>(config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_WIDTH)),
-            boost::any_cast<int>(tizen_browser::config::Config::getInstance().get(CONFIG_KEY::HISTORY_TAB_SERVICE_THUMB_HEIGHT)),
-            true, tools::SnapshotType::ASYNC_LOAD_FINISHED);
 }
 
 void WebView::__loadProgress(void * data, Evas_Object * /* obj */, void * event_info)
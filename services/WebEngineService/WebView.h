@@ -74,6 +74,8 @@ namespace webengine_service {
 
 using download_finish_callback = void (*)(const std::string& file_path, void *data);
 
+struct SnapshotItemData;
+
 class WebView
     : public tizen_browser::interfaces::AbstractRotatable
 {
@@ -95,6 +97,32 @@ public:
     void resume(void);
     bool isSuspended(void) const { return m_suspended; }
 
+    /**
+     * \brief Destroys the web view (and its renderer), keeping the page
+     * uri and scroll position. Only getters of uri, title and origin can
+     * be used, until the view is restored.
+     */
+    void discard(void);
+
+    /**
+     * \brief Recreates discarded web view and loads the page again,
+     * scroll position is restored, when it is loaded.
+     */
+    void restore(void);
+    bool isDiscarded(void) const { return m_discarded; }
+
+    /**
+     * \brief Sets up the view as discarded without creating it, used for
+     * tabs of the restored session. Web view is created and the uri is
+     * loaded on the first restore().
+     */
+    void initDiscarded(bool desktopMode, TabOrigin origin, const std::string& uri);
+
+    /**
+     * \brief Gives the view created ahead (see WebViewPool) to the new tab.
+     */
+    void assignTab(const TabId& tabId, const std::string& title, bool desktopMode, TabOrigin origin);
+
     void stopLoading(void);
     void reload(void);
 
@@ -142,6 +170,13 @@ public:
 
     std::shared_ptr<tizen_browser::tools::BrowserImage> captureSnapshot(int width, int height, bool async,
             tizen_browser::tools::SnapshotType snapshot_type);
+
+    /**
+     * \brief Starts asynchronous capture, snapshot is emitted with snapshotCaptured.
+     *
+     * \return false, if capture cannot be started
+     */
+    bool captureSnapshotAsync(int width, int height, tizen_browser::tools::SnapshotType snapshot_type);
      /**
      * \brief Sets Focus to URI entry.
      */
@@ -382,6 +417,13 @@ private:
     // Screenshot capture
     static void __screenshotCaptured(Evas_Object* image, void* user_data);
 private:
+    /**
+     * \brief Computes area of the view and scale of the snapshot of given size.
+     *
+     * \return false, if the view or area is empty
+     */
+    bool getSnapshotArea(int width, int height, Eina_Rectangle& area, double& scale);
+
     Evas_Object * m_parent;
     TabId m_tabId;
     Evas_Object * m_ewkView;
@@ -397,6 +439,12 @@ private:
     // true if desktop view is enabled, false if mobile
     bool m_desktopMode;
     bool m_suspended;
+    bool m_discarded;
+    // page of discarded view and its scroll position
+    std::string m_discardedURI;
+    int m_discardedScrollX;
+    int m_discardedScrollY;
+    bool m_restoreScroll;
     bool m_private;
     bool m_fullscreen;
     TabOrigin m_origin;
@@ -415,6 +463,8 @@ private:
     int m_status_code;
     Eina_Bool m_is_error_page;
     DownloadControl *m_downloadControl;
+    // asynchronous captures, which are not finished
+    std::vector<SnapshotItemData*> m_snapshotRequests;
 };
 
 } /* namespace webengine_service */
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "browser_config.h"
+#include "WebViewPool.h"
+
+#include "BrowserLogger.h"
+#include "WebView.h"
+
+namespace tizen_browser {
+namespace basic_webengine {
+namespace webengine_service {
+
+WebViewPool::WebViewPool(Create create, std::size_t size)
+    : m_create(create)
+    , m_size(size)
+    , m_fillNormal(false)
+    , m_fillSecret(false)
+    , m_idler(nullptr)
+{
+}
+
+WebViewPool::~WebViewPool()
+{
+    if (m_idler)
+        ecore_idler_del(m_idler);
+}
+
+void WebViewPool::setSize(std::size_t size)
+{
+    m_size = size;
+    for (auto secret : {false, true})
+        while (views(secret).size() > m_size)
+            views(secret).pop_back();
+    scheduleFill();
+}
+
+void WebViewPool::fill(bool secret)
+{
+    BROWSER_LOGD("[%s:%d] secret: %d", __PRETTY_FUNCTION__, __LINE__, secret);
+    (secret ? m_fillSecret : m_fillNormal) = true;
+    scheduleFill();
+}
+
+std::shared_ptr<WebView> WebViewPool::take(bool secret)
+{
+    auto& ready = views(secret);
+    if (ready.empty()) {
+        BROWSER_LOGD("[%s:%d] no view ready", __PRETTY_FUNCTION__, __LINE__);
+        return nullptr;
+    }
+    auto view = ready.front();
+    ready.pop_front();
+    scheduleFill();
+    return view;
+}
+
+void WebViewPool::clear(bool secret)
+{
+    BROWSER_LOGD("[%s:%d] secret: %d", __PRETTY_FUNCTION__, __LINE__, secret);
+    (secret ? m_fillSecret : m_fillNormal) = false;
+    views(secret).clear();
+}
+
+void WebViewPool::clearAll()
+{
+    clear(false);
+    clear(true);
+}
+
+bool WebViewPool::needsView(bool secret) const
+{
+    return (secret ? m_fillSecret : m_fillNormal)
+        && (secret ? m_secretViews : m_normalViews).size() < m_size;
+}
+
+void WebViewPool::scheduleFill()
+{
+    if (!m_idler && (needsView(false) || needsView(true)))
+        m_idler = ecore_idler_add(_fill, this);
+}
+
+Eina_Bool WebViewPool::_fill(void* data)
+{
+    auto self = static_cast<WebViewPool*>(data);
+    // one view per idle call, so the main loop is not blocked for long
+    for (auto secret : {false, true}) {
+        if (self->needsView(secret)) {
+            BROWSER_LOGD("[%s:%d] creating view, secret: %d", __PRETTY_FUNCTION__, __LINE__, secret);
+            self->views(secret).push_back(self->m_create(secret));
+            break;
+        }
+    }
+    if (self->needsView(false) || self->needsView(true))
+        return ECORE_CALLBACK_RENEW;
+    self->m_idler = nullptr;
+    return ECORE_CALLBACK_CANCEL;
+}
+
+} /* end of webengine_service */
+} /* end of basic_webengine */
+} /* end of tizen_browser */
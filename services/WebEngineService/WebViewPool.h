@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WEBVIEWPOOL_H_
+#define WEBVIEWPOOL_H_
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <Ecore.h>
+
+namespace tizen_browser {
+namespace basic_webengine {
+namespace webengine_service {
+
+class WebView;
+
+/**
+ * @brief Keeps initialized, hidden web views ready for new tabs.
+ *
+ * Creating the engine view is the most expensive part of opening a tab,
+ * so views are created ahead, one per main loop idle call. Normal and
+ * secret mode views use different contexts and are pooled separately.
+ */
+class WebViewPool
+{
+public:
+    /// creates suspended, not shown web view of the given mode
+    using Create = std::function<std::shared_ptr<WebView> (bool secret)>;
+
+    explicit WebViewPool(Create create, std::size_t size = 1);
+    ~WebViewPool();
+
+    void setSize(std::size_t size);
+    std::size_t getSize() const { return m_size; }
+
+    /**
+     * @brief Starts keeping views of the mode ready. Views are created in
+     * idle time, not in this call.
+     */
+    void fill(bool secret);
+
+    /**
+     * @brief Returns ready view of the mode or nullptr, if there is none.
+     * The pool is refilled in idle time.
+     */
+    std::shared_ptr<WebView> take(bool secret);
+
+    /// destroys ready views of the mode and stops refilling it
+    void clear(bool secret);
+    void clearAll();
+
+private:
+    std::deque<std::shared_ptr<WebView>>& views(bool secret) { return secret ? m_secretViews : m_normalViews; }
+    bool needsView(bool secret) const;
+    void scheduleFill();
+    static Eina_Bool _fill(void* data);
+
+    Create m_create;
+    std::size_t m_size;
+    std::deque<std::shared_ptr<WebView>> m_normalViews;
+    std::deque<std::shared_ptr<WebView>> m_secretViews;
+    bool m_fillNormal;
+    bool m_fillSecret;
+    Ecore_Idler* m_idler;
+};
+
+} /* end of webengine_service */
+} /* end of basic_webengine */
+} /* end of tizen_browser */
+
+#endif /* WEBVIEWPOOL_H_ */
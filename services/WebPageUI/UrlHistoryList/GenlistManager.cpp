@@ -20,6 +20,7 @@
 #include "UrlMatchesStyler.h"
 #include "GenlistItemsManager.h"
 #include "Config.h"
+#include "Tools/LatencyTracer.h"
 #include <EflTools.h>
 #include <Edje.h>
 
@@ -186,6 +187,7 @@ Evas_Object* GenlistManager::m_itemClassContentGet(void* data, Evas_Object* obj,
 void GenlistManager::prepareUrlsVector(const string& editedUrl,
         shared_ptr<services::HistoryItemVector> matchedEntries)
 {
+    tools::ScopedLatency latency(tools::autocomplete_stage::PREPARE_URLS);
     // free previously used urls. IMPORTANT: it has to be assured that previous
     // genlist items are not using these pointers.
     m_readyUrlPairs.clear();
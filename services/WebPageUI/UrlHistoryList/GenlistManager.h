@@ -73,12 +73,17 @@ public:
 
     /// sent to UrlHistoryList.
     boost::signals2::signal<void(Evas_Object*)> signalGenlistCreated;
+
+    /**
+     * Prepare urls with highlighted matches for the list items. Called by
+     * show(), public for the autocompletion benchmark.
+     */
+    void prepareUrlsVector(const string& editedUrl,
+            shared_ptr<services::HistoryItemVector> matchedEntries);
 private:
     Evas_Object* createGenlist(Evas_Object* parentLayout);
     static Evas_Object* m_itemClassContentGet(void *data, Evas_Object *obj,
             const char *part);
-    void prepareUrlsVector(const string& editedUrl,
-            shared_ptr<services::HistoryItemVector> matchedEntries);
 
     Evas_Object* m_parentLayout;
     Evas_Object* m_genlist;
@@ -22,6 +22,7 @@
 #include "GenlistItemsManager.h"
 #include "WebPageUI/WebPageUIStatesManager.h"
 #include "Config.h"
+#include "Tools/LatencyTracer.h"
 #include <EflTools.h>
 
 namespace tizen_browser {
@@ -127,6 +128,7 @@ void UrlHistoryList::onURLEntryEditedByUser(const string& editedUrl,
         m_genlistManager->show(editedUrl, matchedEntries);
         evas_object_show(m_layout);
     }
+    tools::LatencyTracer::getInstance().stop(tools::autocomplete_stage::KEYSTROKE);
 }
 
 void UrlHistoryList::onItemFocusChange()
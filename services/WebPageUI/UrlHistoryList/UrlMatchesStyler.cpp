@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "Tools/LatencyTracer.h"
+#include "Tools/StringTools.h"
 #include "UrlMatchesStyler.h"
 
 namespace tizen_browser {
@@ -45,95 +47,52 @@ string UrlMatchesStyler::closeTag(const string& tag) const
 string UrlMatchesStyler::getUrlHighlightedMatches(const string& styledUrl,
         const string& highlightingKeywords) const
 {
-    vector<string> keywords;
-    splitKeywordsString(highlightingKeywords, keywords);
-
-    int_pairs rangesHighlight;
-    for (auto key : keywords) {
-        fillOccuranceRanges(styledUrl, key, rangesHighlight);
-    }
-
-    int_pairs mergedRangesHighlight;
-    mergeRanges(rangesHighlight, mergedRangesHighlight);
-    return getTaggedString(styledUrl, mergedRangesHighlight);
-}
-
-void UrlMatchesStyler::splitKeywordsString(const string& keywordsString,
-        vector<string>& resultKeywords) const
-{
-    boost::algorithm::split(resultKeywords, keywordsString,
-            boost::is_any_of("\t "), boost::token_compress_on);
-    // remove empty elements
-    for (auto it = resultKeywords.begin(); it != resultKeywords.end();) {
-        if ((*it).empty()) {
-            it = resultKeywords.erase(it);
-        } else {
-            ++it;
-        }
-    }
-}
-
-void UrlMatchesStyler::fillOccuranceRanges(const string& _checkedString,
-        const string& _searchedMatch, int_pairs& resultRanges) const
-{
-    if (_checkedString.empty() || _searchedMatch.empty())
-        return;
-
-    string checkedString(_checkedString);
-    string searchedMatch(_searchedMatch);
-    boost::algorithm::to_lower(checkedString);
-    boost::algorithm::to_lower(searchedMatch);
-
-    int len = searchedMatch.length();
-    vector<int> positions;
-    getMatchesPositions(checkedString, searchedMatch, positions);
-    for (auto pos : positions) {
-        resultRanges.push_back( { pos, pos + len - 1 });
-    }
-}
-
-void UrlMatchesStyler::getMatchesPositions(const string& checkedString,
-        const string& searchedMatch, vector<int>& resultPositions) const
-{
-    boost::regex match_regex(searchedMatch);
-    for (auto it = boost::sregex_iterator(checkedString.begin(),
-            checkedString.end(), match_regex); it != boost::sregex_iterator();
-            ++it) {
-        resultPositions.push_back(it->position());
+    tools::ScopedLatency latency(tools::autocomplete_stage::HIGHLIGHT);
+    findMatchesRanges(styledUrl, getMatcher(highlightingKeywords), m_ranges);
+
+    string strResult;
+    strResult.reserve(TAG_WHOLE_URL.length() + styledUrl.length()
+            + m_ranges.size() * TAGS_COMPLETE_LEN + TAG_WHOLE_URL_CLOSE.length());
+    strResult.append(TAG_WHOLE_URL);
+    size_t pos = 0;
+    for (const auto& range : m_ranges) {
+        strResult.append(styledUrl, pos, range.first - pos);
+        strResult.append(TAG_COMPLETE);
+        strResult.append(styledUrl, range.first, range.second - range.first);
+        strResult.append(TAG_COMPLETE_CLOSE);
+        pos = range.second;
     }
+    strResult.append(styledUrl, pos, string::npos);
+    strResult.append(TAG_WHOLE_URL_CLOSE);
+    return strResult;
 }
 
-void UrlMatchesStyler::mergeRanges(int_pairs& ranges, int_pairs& result) const
+const tools::KeywordMatcher& UrlMatchesStyler::getMatcher(
+        const string& keywordsString) const
 {
-    if (ranges.size() == 0)
-        return;
-    sort(ranges.begin(), ranges.end());
-
-    auto current = *(ranges.begin());
-    for (auto it = ranges.begin() + 1; it != ranges.end(); ++it) {
-        if (current.second >= it->first) {
-            current.second = max(current.second, it->second);
-        } else {
-            result.push_back(current);
-            current = *it;
-        }
+    if (keywordsString != m_keywordsString) {
+        vector<string> keywords;
+        tools::string_tools::splitString(keywordsString, keywords);
+        m_matcher = tools::KeywordMatcher(keywords);
+        m_keywordsString = keywordsString;
     }
-    result.push_back(current);
+    return m_matcher;
 }
 
-string UrlMatchesStyler::getTaggedString(const string& strToHighlight,
-        const int_pairs& ranges) const
+void UrlMatchesStyler::findMatchesRanges(const string& checkedString,
+        const tools::KeywordMatcher& matcher, ranges& resultRanges) const
 {
-    string strResult(strToHighlight);
-    int insertOffset = 0;
-    for (auto pair : ranges) {
-        strResult.insert(pair.second + insertOffset + 1, TAG_COMPLETE_CLOSE);
-        strResult.insert(pair.first + insertOffset, TAG_COMPLETE);
-        insertOffset += TAGS_COMPLETE_LEN;
-    }
-    strResult.insert(strResult.length(), TAG_WHOLE_URL_CLOSE);
-    strResult.insert(0, TAG_WHOLE_URL);
-    return strResult;
+    resultRanges.clear();
+    // occurrences come ordered by their ends, so a new one can only overlap
+    // the last merged ranges
+    matcher.forEachMatch(checkedString,
+            [&resultRanges](size_t, size_t begin, size_t end) {
+                while (!resultRanges.empty() && resultRanges.back().second > begin) {
+                    begin = min(begin, resultRanges.back().first);
+                    resultRanges.pop_back();
+                }
+                resultRanges.push_back( { begin, end });
+            });
 }
 
 } /* namespace base_ui */
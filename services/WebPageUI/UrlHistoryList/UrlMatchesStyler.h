@@ -19,9 +19,8 @@
 
 #include <string>
 #include <vector>
-#include <boost/algorithm/string.hpp>
-#include <boost/regex.hpp>
 #include "BrowserLogger.h"
+#include "Tools/KeywordMatcher.h"
 
 using namespace std;
 
@@ -36,6 +35,10 @@ public:
 
     /**
      * @brief  Get string containing EFL tags, which are highlighting given keywords.
+     *
+     * Keywords are matched case insensitively, in a single pass over the url.
+     * They are compiled once and reused, as long as they don't change.
+     *
      * @param styledUrl url which will be styled
      * @param highlightingKeyword keywords (entered url) indicating which
      * fragments should be highlighted
@@ -45,7 +48,7 @@ public:
             const string& highlightingKeywords) const;
 
 private:
-    typedef vector<pair<int, int>> int_pairs;
+    typedef vector<pair<size_t, size_t>> ranges;
     const string FONT_COLOR_HIGHLIGHT = "#4088D3";
     const string FONT_COLOR_NORMAL = "#888888";
     const string FONT_SIZE = "35";
@@ -63,45 +66,21 @@ private:
      */
     string closeTag(const string& tag) const;
     /**
-     * @brief splits given string by removing spaces
-     * @param keywordsString string to split
-     * @param resultKeywords vector to which result strings are stored
+     * @brief get matcher for given keywords string, compiling it only
+     * when keywords changed since the previous call
      */
-    void splitKeywordsString(const string& keywordsString,
-            vector<string>& resultKeywords) const;
+    const tools::KeywordMatcher& getMatcher(const string& keywordsString) const;
     /**
-     * @brief Fills vector with ranges describing beginnings end ends of occurrences of one string in another.
-     * @param checkedString the subject of search
-     * @param searchedMatch match to be searched for
-     * @param resultRanges vector filled with found ranges
+     * @brief fills ranges with merged [begin, end) ranges of all keywords
+     * occurrences, sorted by position
      */
-    void fillOccuranceRanges(const string& checkedString,
-            const string& searchedMatch, int_pairs& resultRanges) const;
-    /**
-     * @brief Searches the string for positions of occurrences of another string.
-     * @param checkedString the subject of search
-     * @param searchedMatch string to be searched for
-     * @param resultPositions vector filled with result positions
-     */
-    void getMatchesPositions(const string& checkedString,
-            const string& searchedMatch, vector<int>& resultPositions) const;
-    /**
-     * @brief merges ranges
-     * @param ranges vector of ranges to merge
-     * @param result vector filled with merged ranges
-     */
-    void mergeRanges(int_pairs& ranges, int_pairs& result) const;
-    /**
-     * @brief get string enriched with opening and closing tags on given positions
-     * @param strToHighlight string to be enriched with tags
-     * @param ranges positions of opening and closing tags
-     * @param tag opening tag (for every pair.first)
-     * @param tagClose closing tag (for every pair.second)
-     * @return string with tags
-     */
-    string getTaggedString(const string& strToHighlight,
-            const int_pairs& ranges) const;
+    void findMatchesRanges(const string& checkedString,
+            const tools::KeywordMatcher& matcher, ranges& resultRanges) const;
 
+    mutable string m_keywordsString;
+    mutable tools::KeywordMatcher m_matcher;
+    // reused between rows, to avoid allocations
+    mutable ranges m_ranges;
 };
 
 } /* namespace base_ui */
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Headless url autocompletion benchmark.
+ *
+ * Replays keystroke sequences against synthetic history of 1k, 10k and 100k
+ * rows and prints p50/p95/p99 of every autocompletion stage. History is kept
+ * in process by the bp_history_adaptor functions defined here, which
+ * HistoryService calls instead of the browser-provider daemon. Every
+ * keystroke goes through HistoryService search and GenlistManager url
+ * preparation, like in the browser, without the search worker thread and
+ * the genlist.
+ *
+ * Usage: browser-autocomplete-benchmark [sequences file]
+ * Every line of the file is one typing sequence, '\b' (backslash, b) is
+ * a backspace. Built-in sequences are used, when no file is given.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Elementary.h>
+#include <web/web_history.h>
+
+#include "HistoryService.h"
+#include "Tools/LatencyTracer.h"
+#include "UrlHistoryList/GenlistManager.h"
+
+using namespace tizen_browser;
+namespace stage = tools::autocomplete_stage;
+
+namespace {
+
+const int ITEMS_NUMBER_MAX = 12;
+const unsigned KEYWORD_LENGTH_MIN = 3;
+
+struct HistoryRow
+{
+    std::string url;
+    std::string title;
+    int dateCreated;
+    int dateVisited;
+    int frequency;
+};
+
+// history read by bp_history_adaptor functions, row id is index + 1
+std::vector<HistoryRow> historyRows;
+
+void fillHistory(std::size_t rows)
+{
+    const char* hosts[] = {"www.samsung.com", "news.example.com",
+            "developer.tizen.org", "m.wikipedia.org", "www.google.com",
+            "shop.example.net", "mail.samsung.net", "blog.tizen.org"};
+    const char* words[] = {"news", "article", "search", "products", "help",
+            "download", "settings", "sport", "weather", "music"};
+    const std::size_t hostsCount = sizeof(hosts) / sizeof(hosts[0]);
+    const std::size_t wordsCount = sizeof(words) / sizeof(words[0]);
+    const std::time_t now = std::time(nullptr);
+    std::srand(rows);
+    historyRows.clear();
+    historyRows.reserve(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        const std::string word(words[std::rand() % wordsCount]);
+        HistoryRow row;
+        row.url = std::string(i % 4 ? "https://" : "http://")
+                + hosts[std::rand() % hostsCount] + "/" + word + "/"
+                + std::to_string(std::rand() % (rows / 4 + 1)) + ".html";
+        row.title = word + " " + std::to_string(i);
+        row.dateVisited = now - std::rand() % (90 * 24 * 60 * 60);
+        row.dateCreated = row.dateVisited;
+        row.frequency = 1 + std::rand() % 20;
+        historyRows.push_back(row);
+    }
+}
+
+const HistoryRow* findRow(int id)
+{
+    if (id < 1 || static_cast<std::size_t>(id) > historyRows.size())
+        return nullptr;
+    return &historyRows[id - 1];
+}
+
+// SQL LIKE as used by HistoryService: "%keyword%", case insensitive
+bool matches(const std::string& url, const char* value, bool isLike)
+{
+    if (!isLike)
+        return url == value;
+    std::string keyword(value);
+    keyword.erase(std::remove(keyword.begin(), keyword.end(), '%'), keyword.end());
+    return std::search(url.begin(), url.end(), keyword.begin(), keyword.end(),
+            [](char a, char b) { return std::tolower(a) == std::tolower(b); }) != url.end();
+}
+
+int periodStart(bp_history_date_defs period)
+{
+    // only periods used by url autocompletion and history ids are handled
+    if (period != BP_HISTORY_DATE_TODAY)
+        return 0;
+    std::time_t now = std::time(nullptr);
+    std::tm today;
+    localtime_r(&now, &today);
+    today.tm_hour = 0;
+    today.tm_min = 0;
+    today.tm_sec = 0;
+    return std::mktime(&today);
+}
+
+} /* namespace */
+
+/*
+ * In-process bp_history_adaptor, subset used by HistoryService for url
+ * autocompletion. Data is copied out the same way as by the real adaptor,
+ * so allocation costs are alike.
+ */
+
+int bp_history_adaptor_get_cond_ids_p(int** ids, int* count,
+        bp_history_rows_cond_fmt* conds, const bp_history_offset check_offset,
+        const char* keyword, const int is_like)
+{
+    const int since = periodStart(conds->period_type);
+    const bool periodByCreation = conds->period_offset == BP_HISTORY_O_DATE_CREATED;
+    const bool byCreation = conds->order_offset == BP_HISTORY_O_DATE_CREATED;
+    std::vector<int> found;
+    for (std::size_t i = 0; i < historyRows.size(); ++i) {
+        const HistoryRow& row = historyRows[i];
+        if ((periodByCreation ? row.dateCreated : row.dateVisited) < since)
+            continue;
+        if ((check_offset & BP_HISTORY_O_URL) && keyword && !matches(row.url, keyword, is_like))
+            continue;
+        found.push_back(i + 1);
+    }
+    std::stable_sort(found.begin(), found.end(), [byCreation, conds](int a, int b) {
+        const HistoryRow& rowA = historyRows[a - 1];
+        const HistoryRow& rowB = historyRows[b - 1];
+        const int dateA = byCreation ? rowA.dateCreated : rowA.dateVisited;
+        const int dateB = byCreation ? rowB.dateCreated : rowB.dateVisited;
+        return conds->ordering ? dateA > dateB : dateA < dateB;
+    });
+    if (conds->offset > 0)
+        found.erase(found.begin(), found.begin()
+                + std::min<std::size_t>(conds->offset, found.size()));
+    if (conds->limit >= 0 && found.size() > static_cast<std::size_t>(conds->limit))
+        found.resize(conds->limit);
+
+    *ids = static_cast<int*>(std::malloc(std::max<std::size_t>(found.size(), 1) * sizeof(int)));
+    std::copy(found.begin(), found.end(), *ids);
+    *count = found.size();
+    return 0;
+}
+
+int bp_history_adaptor_get_info(const int id, const bp_history_offset offset,
+        bp_history_info_fmt* info)
+{
+    const HistoryRow* row = findRow(id);
+    if (!row)
+        return -1;
+    std::memset(info, 0, sizeof(*info));
+    if (offset & BP_HISTORY_O_URL)
+        info->url = strdup(row->url.c_str());
+    if (offset & BP_HISTORY_O_TITLE)
+        info->title = strdup(row->title.c_str());
+    if (offset & BP_HISTORY_O_DATE_CREATED)
+        info->date_created = row->dateCreated;
+    if (offset & BP_HISTORY_O_DATE_VISITED)
+        info->date_visited = row->dateVisited;
+    if (offset & BP_HISTORY_O_FREQUENCY)
+        info->frequency = row->frequency;
+    return 0;
+}
+
+int bp_history_adaptor_easy_free(bp_history_info_fmt* info)
+{
+    std::free(info->url);
+    std::free(info->title);
+    return 0;
+}
+
+int bp_history_adaptor_get_errorcode(void)
+{
+    return BP_HISTORY_ERROR_NONE;
+}
+
+namespace {
+
+/**
+ * Autocompletion done by HistoryService (search worker) and GenlistManager
+ * (suggestions list).
+ */
+class AutocompletePipeline
+{
+public:
+    AutocompletePipeline()
+    {
+        // indexes are built on HistoryService thread
+        auto start = std::chrono::steady_clock::now();
+        while (!m_history.isIndexReady())
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::printf("  index built in %lld ms\n", static_cast<long long>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - start).count()));
+    }
+
+    void keystroke(const std::string& editedUrl)
+    {
+        tools::LatencyTracer::getInstance().start(stage::KEYSTROKE);
+        // UrlHistoryList gets matches of HistoryService::searchHistoryItemsByKeywordsString
+        std::shared_ptr<services::HistoryItemVector> items =
+                m_history.getHistoryItemsByKeywordsString(editedUrl,
+                        ITEMS_NUMBER_MAX, KEYWORD_LENGTH_MIN, true);
+        if (!items->empty())
+            m_genlist.prepareUrlsVector(editedUrl, items);
+        tools::LatencyTracer::getInstance().stop(stage::KEYSTROKE);
+    }
+
+private:
+    services::HistoryService m_history;
+    base_ui::GenlistManager m_genlist;
+};
+
+std::vector<std::string> defaultSequences()
+{
+    return {
+        "samsung",
+        "news exmaple\\b\\b\\b\\bample",
+        "https://www.goo",
+        "tizen dev\\b\\b\\bdeveloper help",
+        "wiki sport 12",
+        "shop products downlaod\\b\\b\\b\\boad",
+    };
+}
+
+// entry contents after every keystroke of the sequence
+std::vector<std::string> replay(const std::string& sequence)
+{
+    std::vector<std::string> states;
+    std::string entry;
+    for (std::size_t i = 0; i < sequence.length(); ++i) {
+        if (sequence.compare(i, 2, "\\b") == 0) {
+            if (!entry.empty())
+                entry.erase(entry.length() - 1);
+            ++i;
+        } else {
+            entry += sequence[i];
+        }
+        states.push_back(entry);
+    }
+    return states;
+}
+
+void printStats()
+{
+    tools::LatencyTracer& tracer = tools::LatencyTracer::getInstance();
+    std::printf("  %-50s %8s %10s %10s %10s\n", "stage", "samples",
+            "p50 [ms]", "p95 [ms]", "p99 [ms]");
+    for (const auto& name : tracer.getStages()) {
+        const tools::LatencyTracer::Stats stats = tracer.getStats(name);
+        std::printf("  %-50s %8zu %10.4f %10.4f %10.4f\n", name.c_str(),
+                stats.count, stats.p50, stats.p95, stats.p99);
+    }
+}
+
+} /* namespace */
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> sequences;
+    if (argc > 1) {
+        std::ifstream file(argv[1]);
+        if (!file) {
+            std::fprintf(stderr, "cannot open %s\n", argv[1]);
+            return 1;
+        }
+        for (std::string line; std::getline(file, line);)
+            if (!line.empty())
+                sequences.push_back(line);
+    } else {
+        sequences = defaultSequences();
+    }
+
+    // GenlistManager uses elementary config and item classes
+    elm_init(argc, argv);
+    tools::LatencyTracer& tracer = tools::LatencyTracer::getInstance();
+    tracer.setEnabled(true);
+    for (std::size_t rows : {1000, 10000, 100000}) {
+        std::printf("%zu history rows:\n", rows);
+        fillHistory(rows);
+        AutocompletePipeline pipeline;
+        tracer.reset();
+        // every sequence is typed several times, to have enough samples
+        // for high percentiles
+        for (int round = 0; round < 8; ++round)
+            for (const auto& sequence : sequences)
+                for (const auto& entry : replay(sequence))
+                    pipeline.keystroke(entry);
+        printStats();
+    }
+    elm_shutdown();
+    return 0;
+}
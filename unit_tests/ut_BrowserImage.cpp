@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "BrowserImage.h"
+
+using tizen_browser::tools::BrowserImage;
+using tizen_browser::tools::ImageType;
+
+BOOST_AUTO_TEST_SUITE(browser_image)
+
+BOOST_AUTO_TEST_CASE(browser_image_shared_data)
+{
+    BROWSER_LOGI("[UT] BrowserImage - browser_image_shared_data - START --> ");
+
+    char pixels[] = "0123456789abcdef";
+    auto image = std::make_shared<BrowserImage>(2, 2, 16);
+
+    // foreign data is copied once
+    image->setData(pixels, false, ImageType::ImageTypeEvasObject);
+    BOOST_CHECK(image->getData() != pixels);
+    BOOST_CHECK(std::memcmp(image->getData(), pixels, 16) == 0);
+
+    // copies share the data
+    BrowserImage copy(*image);
+    BOOST_CHECK(copy.getData() == image->getData());
+    BOOST_CHECK(copy.getSize() == 16);
+    BOOST_CHECK(copy.getImageType() == ImageType::ImageTypeEvasObject);
+
+    // data outlives the image it was set to
+    const void* data = image->getData();
+    image.reset();
+    BOOST_CHECK(copy.getData() == data);
+    BOOST_CHECK(std::memcmp(copy.getData(), pixels, 16) == 0);
+
+    // owned buffer is taken without copying
+    void* buffer = malloc(16);
+    BrowserImage taken(2, 2, 16);
+    taken.takeData(buffer, ImageType::ImageTypePNG);
+    BOOST_CHECK(taken.getData() == buffer);
+    BOOST_CHECK(taken.isEncoded());
+
+    // shared memory is neither copied nor released
+    BrowserImage shared(2, 2, 16);
+    shared.setData(pixels, true, ImageType::ImageTypeEvasObject);
+    BOOST_CHECK(shared.getData() == pixels);
+    BOOST_CHECK(shared.isSharedData());
+
+    BROWSER_LOGI("[UT] --> END - BrowserImage - browser_image_shared_data");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "HistoryJournal.h"
+
+using tizen_browser::services::HistoryJournal;
+using tizen_browser::tools::BrowserImage;
+
+BOOST_AUTO_TEST_SUITE(history_journal)
+
+BOOST_AUTO_TEST_CASE(history_journal_merge)
+{
+    BROWSER_LOGI("[UT] HistoryJournal - history_journal_merge - START --> ");
+
+    std::mutex mutex;
+    std::vector<std::vector<HistoryJournal::Entry>> batches;
+    {
+        // delay long enough, so only flush writes the entries
+        HistoryJournal journal([&](const std::vector<HistoryJournal::Entry>& entries) {
+                std::lock_guard<std::mutex> lock(mutex);
+                batches.push_back(entries);
+            }, std::chrono::hours(1));
+
+        auto favicon = std::make_shared<BrowserImage>();
+        auto snapshot = std::make_shared<BrowserImage>();
+        journal.visit("http://www.samsung.com/", "Samsung", nullptr);
+        journal.setFavicon("http://www.samsung.com/", favicon);
+        journal.visit("http://www.tizen.org/", "Tizen", nullptr);
+        journal.setSnapshot("http://www.samsung.com/", snapshot);
+        journal.visit("http://www.samsung.com/", "Samsung Electronics", nullptr);
+        journal.flush();
+
+        BOOST_REQUIRE_EQUAL(1u, batches.size());
+        BOOST_REQUIRE_EQUAL(2u, batches[0].size());
+        const HistoryJournal::Entry& samsung = batches[0][0];
+        BOOST_CHECK_EQUAL("http://www.samsung.com/", samsung.url);
+        BOOST_CHECK_EQUAL("Samsung Electronics", samsung.title);
+        BOOST_CHECK_EQUAL(2, samsung.visits);
+        // visit without favicon keeps the one set before
+        BOOST_CHECK(samsung.favicon == favicon);
+        BOOST_CHECK(samsung.snapshot == snapshot);
+        BOOST_CHECK_EQUAL(1, batches[0][1].visits);
+
+        // nothing pending, nothing written
+        journal.flush();
+        BOOST_CHECK_EQUAL(1u, batches.size());
+
+        // discarded entries are not written
+        journal.visit("http://www.tizen.org/", "Tizen", nullptr);
+        journal.discard();
+        journal.flush();
+        BOOST_CHECK_EQUAL(1u, batches.size());
+
+        // image update only, written, when the journal is destroyed
+        journal.setSnapshot("http://www.tizen.org/", snapshot);
+    }
+    BOOST_REQUIRE_EQUAL(2u, batches.size());
+    BOOST_REQUIRE_EQUAL(1u, batches[1].size());
+    BOOST_CHECK_EQUAL(0, batches[1][0].visits);
+    BOOST_CHECK(batches[1][0].snapshot);
+
+    BROWSER_LOGI("[UT] --> END - HistoryJournal - history_journal_merge");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "HistoryItem.h"
+#include "HistoryMatchIndex.h"
+#include "HistoryServiceTools.h"
+
+using tizen_browser::services::HistoryItem;
+using tizen_browser::services::HistoryItemVector;
+using tizen_browser::services::HistoryMatchIndex;
+
+BOOST_AUTO_TEST_SUITE(history_match_index)
+
+BOOST_AUTO_TEST_CASE(match_index_find)
+{
+    BROWSER_LOGI("[UT] HistoryMatchIndex - match_index_find - START --> ");
+
+    HistoryMatchIndex index;
+    index.insert(1, "http://www.Example.com/a", 10);
+    index.insert(2, "http://example.com/b", 20);
+    index.insert(3, "http://www.example.com/a", 30);
+    index.insert(4, "http://other.org", 40);
+
+    // equally ranked, so the most recently visited first, case insensitive
+    std::vector<int> result = index.find({"example"}, -1, false);
+    BOOST_CHECK_EQUAL(3u, result.size());
+    BOOST_CHECK_EQUAL(3, result.at(0));
+
+    // duplicated urls are skipped
+    result = index.find({"example"}, -1, true);
+    BOOST_CHECK_EQUAL(2u, result.size());
+
+    // all keywords have to match
+    result = index.find({"example", "/b"}, -1, false);
+    BOOST_CHECK_EQUAL(1u, result.size());
+    BOOST_CHECK_EQUAL(2, result.at(0));
+
+    // keywords shorter than trigram and shortening
+    result = index.find({"ex"}, 1, false);
+    BOOST_CHECK_EQUAL(1u, result.size());
+
+    BROWSER_LOGI("[UT] --> END - HistoryMatchIndex - match_index_find");
+}
+
+BOOST_AUTO_TEST_CASE(match_index_update)
+{
+    BROWSER_LOGI("[UT] HistoryMatchIndex - match_index_update - START --> ");
+
+    HistoryMatchIndex index;
+    index.insert(1, "http://example.com/a", 10);
+    index.insert(2, "http://example.com/b", 20);
+
+    index.visit(1, 30);
+    BOOST_CHECK_EQUAL(1, index.find({"example"}, -1, false).at(0));
+
+    index.remove(1);
+    BOOST_CHECK_EQUAL(1u, index.find({"example"}, -1, false).size());
+    BOOST_CHECK(index.find({"com/a"}, -1, false).empty());
+
+    index.clear();
+    BOOST_CHECK(index.empty());
+    BOOST_CHECK(index.find({"example"}, -1, false).empty());
+
+    BROWSER_LOGI("[UT] --> END - HistoryMatchIndex - match_index_update");
+}
+
+BOOST_AUTO_TEST_CASE(match_index_ranking)
+{
+    BROWSER_LOGI("[UT] HistoryMatchIndex - match_index_ranking - START --> ");
+
+    const std::time_t now = std::time(nullptr);
+    const std::time_t day = 24 * 60 * 60;
+    HistoryMatchIndex index;
+    index.insert(1, "http://www.news.com/example", now, 1);
+    index.insert(2, "http://example.com/", now - 30 * day, 20);
+    index.insert(3, "http://example.com/", now - 31 * day, 20);
+    index.insert(4, "http://search.org/?q=example", now, 1);
+
+    // frequently visited host prefix match wins with recent one-off visits
+    std::vector<int> result = index.find({"example"}, 2, true);
+    BOOST_CHECK_EQUAL(2u, result.size());
+    BOOST_CHECK_EQUAL(2, result.at(0));
+
+    // the best ones are returned, even if list is shortened
+    result = index.find({"example"}, 1, false);
+    BOOST_CHECK_EQUAL(1u, result.size());
+    BOOST_CHECK_EQUAL(2, result.at(0));
+
+    BROWSER_LOGI("[UT] --> END - HistoryMatchIndex - match_index_ranking");
+}
+
+BOOST_AUTO_TEST_CASE(match_index_url_duplicates)
+{
+    BROWSER_LOGI("[UT] HistoryMatchIndex - match_index_url_duplicates - START --> ");
+
+    HistoryMatchIndex index;
+    index.insert(1, "http://www.example.com/", 10);
+    index.insert(2, "https://example.com", 20);
+    index.insert(3, "http://example.com/a", 30);
+    index.insert(4, "http://example.com/b", 40);
+
+    // duplicates are merged before shortening, so the list is full
+    std::vector<int> result = index.find({"example"}, 2, true);
+    BOOST_CHECK_EQUAL(2u, result.size());
+    result = index.find({"example"}, -1, true);
+    BOOST_CHECK_EQUAL(3u, result.size());
+    BOOST_CHECK(std::find(result.begin(), result.end(), 1) == result.end());
+
+    auto items = std::make_shared<HistoryItemVector>();
+    items->push_back(std::make_shared<HistoryItem>(1, "http://www.example.com/"));
+    items->push_back(std::make_shared<HistoryItem>(2, "http://example.com/a"));
+    items->push_back(std::make_shared<HistoryItem>(3, "https://example.com"));
+    items->push_back(std::make_shared<HistoryItem>(4, "example.com/a/"));
+    items->push_back(std::make_shared<HistoryItem>(5, "HTTP://WWW.Example.com/A"));
+    tizen_browser::services::removeUrlDuplicates(items);
+    BOOST_CHECK_EQUAL(2u, items->size());
+    BOOST_CHECK_EQUAL(1, items->at(0)->getId());
+    BOOST_CHECK_EQUAL(2, items->at(1)->getId());
+
+    BROWSER_LOGI("[UT] --> END - HistoryMatchIndex - match_index_url_duplicates");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "HistoryUrlIndex.h"
+
+using tizen_browser::services::HistoryUrlIndex;
+
+BOOST_AUTO_TEST_SUITE(history_url_index)
+
+BOOST_AUTO_TEST_CASE(url_index_find)
+{
+    BROWSER_LOGI("[UT] HistoryUrlIndex - url_index_find - START --> ");
+
+    HistoryUrlIndex index;
+    index.insert(1, "http://www.example.com/", 100);
+    index.insert(2, "http://www.example.com/a", 150);
+    index.insert(3, "http://www.example.com/", 200);
+
+    // the most recently created entry of the exact url
+    BOOST_CHECK_EQUAL(3, index.find("http://www.example.com/"));
+    BOOST_CHECK_EQUAL(0, index.find("http://www.Example.com/"));
+    BOOST_CHECK_EQUAL(0, index.find("http://www.example.com"));
+    BOOST_CHECK_EQUAL(2, index.find("http://www.example.com/a"));
+    BOOST_CHECK_EQUAL(0, index.find("http://www.example.com/b"));
+
+    // visits are added only to entries created since the given date
+    BOOST_CHECK_EQUAL(3, index.find("http://www.example.com/", 200));
+    BOOST_CHECK_EQUAL(0, index.find("http://www.example.com/", 201));
+
+    // entries inserted out of order are still sorted by creation date
+    index.insert(4, "http://www.example.com/", 50);
+    BOOST_CHECK_EQUAL(3, index.find("http://www.example.com/"));
+    index.remove(3);
+    BOOST_CHECK_EQUAL(1, index.find("http://www.example.com/"));
+
+    BROWSER_LOGI("[UT] --> END - HistoryUrlIndex - url_index_find");
+}
+
+BOOST_AUTO_TEST_CASE(url_index_update)
+{
+    BROWSER_LOGI("[UT] HistoryUrlIndex - url_index_update - START --> ");
+
+    HistoryUrlIndex index;
+    index.insert(1, "http://www.example.com/", 100);
+    index.insert(2, "http://www.example.com/", 200);
+
+    index.remove(2);
+    BOOST_CHECK_EQUAL(1, index.find("http://www.example.com/"));
+    BOOST_CHECK_EQUAL(1u, index.size());
+
+    // reinserted entry replaces the old one
+    index.insert(1, "http://www.example.com/b", 300);
+    BOOST_CHECK_EQUAL(0, index.find("http://www.example.com/"));
+    BOOST_CHECK_EQUAL(1, index.find("http://www.example.com/b"));
+
+    index.remove(5);
+    BOOST_CHECK_EQUAL(1u, index.size());
+
+    // index built elsewhere is moved in, its entries are still updated
+    HistoryUrlIndex built(std::move(index));
+    built.insert(2, "http://www.example.com/c", 400);
+    built.remove(1);
+    BOOST_CHECK_EQUAL(0, built.find("http://www.example.com/b"));
+    BOOST_CHECK_EQUAL(2, built.find("http://www.example.com/c"));
+    index = std::move(built);
+    BOOST_CHECK_EQUAL(1u, index.size());
+
+    index.clear();
+    BOOST_CHECK_EQUAL(0u, index.size());
+    BOOST_CHECK_EQUAL(0, index.find("http://www.example.com/b"));
+
+    BROWSER_LOGI("[UT] --> END - HistoryUrlIndex - url_index_update");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
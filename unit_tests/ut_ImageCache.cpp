@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "BrowserImage.h"
+#include "ImageCache.h"
+
+using tizen_browser::services::ImageCache;
+using tizen_browser::tools::BrowserImage;
+
+BOOST_AUTO_TEST_SUITE(image_cache)
+
+BOOST_AUTO_TEST_CASE(image_cache_lru_eviction)
+{
+    BROWSER_LOGI("[UT] ImageCache - image_cache_lru_eviction - START --> ");
+
+    ImageCache cache(300);
+    cache.put(1, std::make_shared<BrowserImage>(10, 10, 100));
+    cache.put(2, std::make_shared<BrowserImage>(10, 10, 100));
+    cache.put(3, std::make_shared<BrowserImage>(10, 10, 100));
+    BOOST_CHECK(cache.size() == 300);
+
+    // 1 becomes the most recently used, so 2 is evicted
+    BOOST_CHECK(cache.get(1));
+    cache.put(4, std::make_shared<BrowserImage>(10, 10, 100));
+    BOOST_CHECK(!cache.get(2));
+    BOOST_CHECK(cache.contains(1));
+    BOOST_CHECK(cache.contains(3));
+    BOOST_CHECK(cache.contains(4));
+    BOOST_CHECK(cache.size() == 300);
+
+    // replacing an image updates the size, too big images are not cached
+    cache.put(3, std::make_shared<BrowserImage>(10, 10, 50));
+    BOOST_CHECK(cache.size() == 250);
+    cache.put(5, std::make_shared<BrowserImage>(10, 10, 301));
+    BOOST_CHECK(!cache.contains(5));
+
+    cache.remove(1);
+    BOOST_CHECK(cache.size() == 150);
+    BOOST_CHECK(cache.hits() == 1);
+    BOOST_CHECK(cache.misses() == 1);
+    BOOST_CHECK(cache.evictions() == 2);
+
+    BROWSER_LOGI("[UT] --> END - ImageCache - image_cache_lru_eviction");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "Tools/KeywordMatcher.h"
+#include "Tools/StringTools.h"
+
+using tizen_browser::tools::KeywordMatcher;
+namespace string_tools = tizen_browser::tools::string_tools;
+
+BOOST_AUTO_TEST_SUITE(keyword_matcher)
+
+BOOST_AUTO_TEST_CASE(keyword_matcher_matches)
+{
+    BROWSER_LOGI("[UT] KeywordMatcher - keyword_matcher_matches - START --> ");
+
+    KeywordMatcher matcher({"example", "/B", "", "EXAMPLE"});
+    BOOST_CHECK_EQUAL(2u, matcher.size());
+    BOOST_CHECK(matcher.matchesAll("http://www.Example.com/b"));
+    BOOST_CHECK(!matcher.matchesAll("http://www.example.com/a"));
+    BOOST_CHECK(matcher.matchesAny("http://www.example.com/a"));
+    BOOST_CHECK(!matcher.matchesAny("http://exampl.com/"));
+
+    // overlapping keywords, one being a suffix of another
+    KeywordMatcher overlapping({"abab", "bab", "b"});
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    overlapping.forEachMatch("xABABab", [&ranges](std::size_t, std::size_t begin, std::size_t end) {
+        ranges.push_back({begin, end});
+    });
+    const std::vector<std::pair<std::size_t, std::size_t>> expected{
+        {2, 3}, {1, 5}, {2, 5}, {4, 5}, {3, 7}, {4, 7}, {6, 7}};
+    BOOST_CHECK(expected == ranges);
+
+    // no keywords match everything, but nothing in particular
+    KeywordMatcher empty;
+    BOOST_CHECK(empty.matchesAll("abc"));
+    BOOST_CHECK(!empty.matchesAny("abc"));
+
+    BROWSER_LOGI("[UT] --> END - KeywordMatcher - keyword_matcher_matches");
+}
+
+BOOST_AUTO_TEST_CASE(keyword_matcher_benchmark)
+{
+    BROWSER_LOGI("[UT] KeywordMatcher - keyword_matcher_benchmark - START --> ");
+
+    const std::size_t URLS_COUNT = 50000;
+    const char* hosts[] = {"www.Example.com", "news.example.org", "m.Tizen.org",
+            "developer.samsung.com", "search.example.net"};
+    std::vector<std::string> urls;
+    urls.reserve(URLS_COUNT);
+    for (std::size_t i = 0; i < URLS_COUNT; ++i)
+        urls.push_back(std::string(i % 3 ? "https://" : "http://")
+                + hosts[i % 5] + "/Articles/" + std::to_string(i * 7919 % 100000)
+                + "/page-" + std::to_string(i) + ".html?ref=home");
+
+    const std::vector<std::vector<std::string>> queries{
+        {"example"}, {"tizen", "articles"}, {"samsung", "page-4", "html"},
+        {"org", "12", "ref=", "news", "s/"}};
+
+    using clock = std::chrono::steady_clock;
+    for (const auto& keywords : queries) {
+        // current implementation: lowercased url copies and a search per keyword
+        std::size_t expected = 0;
+        const auto referenceBegin = clock::now();
+        for (const auto& url : urls) {
+            const std::string lowerUrl(boost::algorithm::to_lower_copy(url));
+            if (string_tools::stringMatchesKeywords(lowerUrl, keywords.begin(), keywords.end()))
+                ++expected;
+        }
+        const auto referenceEnd = clock::now();
+
+        std::size_t found = 0;
+        const KeywordMatcher matcher(keywords);
+        for (const auto& url : urls)
+            if (matcher.matchesAll(url))
+                ++found;
+        const auto matcherEnd = clock::now();
+
+        BOOST_CHECK_EQUAL(expected, found);
+        BOOST_TEST_MESSAGE(keywords.size() << " keyword(s), " << found << " matches: "
+                << "simplePatternMatch "
+                << std::chrono::duration_cast<std::chrono::microseconds>(referenceEnd - referenceBegin).count()
+                << "us, KeywordMatcher "
+                << std::chrono::duration_cast<std::chrono::microseconds>(matcherEnd - referenceEnd).count()
+                << "us");
+    }
+
+    BROWSER_LOGI("[UT] --> END - KeywordMatcher - keyword_matcher_benchmark");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
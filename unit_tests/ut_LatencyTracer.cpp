@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "Tools/LatencyTracer.h"
+
+using tizen_browser::tools::LatencyTracer;
+
+BOOST_AUTO_TEST_SUITE(latency_tracer)
+
+BOOST_AUTO_TEST_CASE(latency_tracer_percentiles)
+{
+    BROWSER_LOGI("[UT] LatencyTracer - latency_tracer_percentiles - START --> ");
+
+    LatencyTracer& tracer = LatencyTracer::getInstance();
+    tracer.reset();
+
+    // nothing is recorded, when disabled
+    tracer.setEnabled(false);
+    tracer.record("stage", std::chrono::milliseconds(1));
+    BOOST_CHECK(tracer.getStages().empty());
+
+    tracer.setEnabled(true);
+    for (int ms = 1; ms <= 100; ++ms)
+        tracer.record("stage", std::chrono::milliseconds(ms));
+    LatencyTracer::Stats stats = tracer.getStats("stage");
+    BOOST_CHECK_EQUAL(100u, stats.count);
+    BOOST_CHECK_CLOSE(50.0, stats.p50, 0.001);
+    BOOST_CHECK_CLOSE(95.0, stats.p95, 0.001);
+    BOOST_CHECK_CLOSE(99.0, stats.p99, 0.001);
+    BOOST_CHECK_CLOSE(100.0, stats.max, 0.001);
+
+    // only the last samples are kept
+    for (std::size_t i = 0; i < LatencyTracer::SAMPLES_MAX; ++i)
+        tracer.record("stage", std::chrono::milliseconds(200));
+    stats = tracer.getStats("stage");
+    BOOST_CHECK_EQUAL(LatencyTracer::SAMPLES_MAX, stats.count);
+    BOOST_CHECK_CLOSE(200.0, stats.p50, 0.001);
+
+    // stopped only once
+    tracer.start("span");
+    tracer.stop("span");
+    tracer.stop("span");
+    BOOST_CHECK_EQUAL(1u, tracer.getStats("span").count);
+    BOOST_CHECK_EQUAL(0u, tracer.getStats("unknown").count);
+
+    tracer.reset();
+    tracer.setEnabled(false);
+
+    BROWSER_LOGI("[UT] --> END - LatencyTracer - latency_tracer_percentiles");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "SnapshotScheduler.h"
+
+using tizen_browser::basic_webengine::TabId;
+using tizen_browser::basic_webengine::webengine_service::SnapshotScheduler;
+using tizen_browser::tools::BrowserImage;
+using tizen_browser::tools::SnapshotType;
+
+BOOST_AUTO_TEST_SUITE(snapshot_scheduler)
+
+BOOST_AUTO_TEST_CASE(snapshot_scheduler_coalescing)
+{
+    BROWSER_LOGI("[UT] SnapshotScheduler - snapshot_scheduler_coalescing - START --> ");
+
+    std::vector<std::pair<int, SnapshotType>> captures;
+    bool captureStarts = true;
+    SnapshotScheduler scheduler(
+        [&](const TabId& id, int, int, SnapshotType type) -> boost::optional<std::string> {
+            if (!captureStarts)
+                return boost::none;
+            captures.push_back(std::make_pair(id.get(), type));
+            return std::string("http://www.samsung.com/");
+        },
+        [](std::shared_ptr<BrowserImage>, SnapshotType, const TabId&, const std::string&) {});
+
+    // synchronous snapshots are not scheduled
+    scheduler.request(TabId(1), 100, 50, SnapshotType::SYNC);
+    BOOST_CHECK(captures.empty());
+
+    // requests made, while the capture is in flight, end in one more capture
+    scheduler.request(TabId(1), 100, 50, SnapshotType::ASYNC_TAB);
+    scheduler.request(TabId(1), 100, 50, SnapshotType::ASYNC_LOAD_FINISHED);
+    scheduler.request(TabId(1), 100, 50, SnapshotType::ASYNC_TAB);
+    scheduler.request(TabId(2), 100, 50, SnapshotType::ASYNC_TAB);
+    BOOST_CHECK_EQUAL(2u, captures.size());
+    BOOST_CHECK(scheduler.isInFlight(TabId(1)));
+    BOOST_CHECK(scheduler.isPending(TabId(1)));
+    BOOST_CHECK(!scheduler.isPending(TabId(2)));
+
+    scheduler.captured(TabId(1), std::make_shared<BrowserImage>(), SnapshotType::ASYNC_TAB);
+    BOOST_CHECK_EQUAL(3u, captures.size());
+    BOOST_CHECK_EQUAL(1, captures.back().first);
+    BOOST_CHECK(SnapshotType::ASYNC_LOAD_FINISHED == captures.back().second);
+    BOOST_CHECK(!scheduler.isPending(TabId(1)));
+
+    scheduler.captured(TabId(1), std::make_shared<BrowserImage>(), SnapshotType::ASYNC_LOAD_FINISHED);
+    BOOST_CHECK(!scheduler.isInFlight(TabId(1)));
+
+    // bookmark snapshots are not merged with tab thumbnails
+    scheduler.request(TabId(2), 200, 100, SnapshotType::ASYNC_BOOKMARK);
+    BOOST_CHECK_EQUAL(4u, captures.size());
+    BOOST_CHECK(!scheduler.isPending(TabId(2)));
+
+    // closed tab is not captured again
+    scheduler.request(TabId(2), 100, 50, SnapshotType::ASYNC_TAB);
+    scheduler.cancel(TabId(2));
+    scheduler.captured(TabId(2), std::make_shared<BrowserImage>(), SnapshotType::ASYNC_TAB);
+    BOOST_CHECK_EQUAL(4u, captures.size());
+    BOOST_CHECK(!scheduler.isInFlight(TabId(2)));
+
+    // nothing is in flight, when capture cannot be started
+    captureStarts = false;
+    scheduler.request(TabId(3), 100, 50, SnapshotType::ASYNC_TAB);
+    BOOST_CHECK(!scheduler.isInFlight(TabId(3)));
+
+    BROWSER_LOGI("[UT] --> END - SnapshotScheduler - snapshot_scheduler_coalescing");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -16,6 +16,7 @@
  *
  */
 
+#include <cstdio>
 #include <memory>
 #include <string>
 #include <boost/test/unit_test.hpp>
@@ -24,6 +25,8 @@
 #include "BrowserLogger.h"
 #include "StorageService.h"
 #include "StorageException.h"
+#include "SQLDatabase.h"
+#include "SQLTransactionScope.h"
 //#include "HistoryItem.h"
 
 #define CHANNEL_AUTH01 "Gall Anonim 1"
@@ -110,6 +113,75 @@ BOOST_AUTO_TEST_CASE(storage_settings)
     BROWSER_LOGI("[UT] --> END - StorageService - storage_settings");
 }
 
+BOOST_AUTO_TEST_CASE(storage_sql_statement_cache)
+{
+    BROWSER_LOGI("[UT] StorageService - storage_sql_statement_cache - START --> ");
+
+    auto db = tizen_browser::storage::SQLDatabase::newInstance();
+    db->open(":memory:");
+    db->exec("CREATE TABLE T (K TEXT PRIMARY KEY, V INTEGER)");
+
+    // cached statement is reused, bindings of previous use are cleared
+    const std::string insert = "INSERT INTO T (K, V) VALUES (?, ?)";
+    for (int i = 0; i < 10; ++i) {
+        tizen_browser::storage::SQLQuery query(db->prepare(insert));
+        query.bindText(1, std::to_string(i));
+        if (i % 2)
+            query.bindInt(2, i);
+        query.exec();
+    }
+
+    const std::string select = "SELECT COUNT(*) FROM T WHERE V IS NULL";
+    for (int i = 0; i < 2; ++i) {
+        tizen_browser::storage::SQLQuery query(db->prepare(select));
+        query.exec();
+        BOOST_CHECK(query.getInt(0) == 5);
+    }
+
+    // the same query executed twice at once
+    tizen_browser::storage::SQLQuery first(db->prepare("SELECT K FROM T ORDER BY K"));
+    tizen_browser::storage::SQLQuery second(db->prepare("SELECT K FROM T ORDER BY K"));
+    first.exec();
+    second.exec();
+    first.next();
+    BOOST_CHECK(first.getString(0) == "1");
+    BOOST_CHECK(second.getString(0) == "0");
+
+    BROWSER_LOGI("[UT] --> END - StorageService - storage_sql_statement_cache");
+}
+
+BOOST_AUTO_TEST_CASE(storage_sql_read_does_not_block_writer)
+{
+    BROWSER_LOGI("[UT] StorageService - storage_sql_read_does_not_block_writer - START --> ");
+
+    const std::string path = "ut_storage_wal.db";
+    std::remove(path.c_str());
+    auto reader = tizen_browser::storage::SQLDatabase::newInstance();
+    reader->open(path);
+    reader->exec("CREATE TABLE T (V INTEGER)");
+    auto writer = reader->cloneForThread();
+
+    {
+        tizen_browser::storage::SQLTransactionScope read(reader, tizen_browser::storage::TransactionMode::Read);
+        tizen_browser::storage::SQLQuery count(reader->prepare("SELECT COUNT(*) FROM T"));
+        count.exec();
+        BOOST_CHECK(count.getInt(0) == 0);
+
+        // writer commits while read transaction is still open
+        tizen_browser::storage::SQLTransactionScope write(writer);
+        tizen_browser::storage::SQLQuery insert(writer->prepare("INSERT INTO T (V) VALUES (?)"));
+        insert.bindInt(1, 1);
+        BOOST_CHECK_NO_THROW(insert.exec());
+        BOOST_CHECK_NO_THROW(write.commit());
+    }
+
+    tizen_browser::storage::SQLQuery count(reader->prepare("SELECT COUNT(*) FROM T"));
+    count.exec();
+    BOOST_CHECK(count.getInt(0) == 1);
+
+    BROWSER_LOGI("[UT] --> END - StorageService - storage_sql_read_does_not_block_writer");
+}
+
 // Should it be moved to ut_historyService ????
 //BOOST_AUTO_TEST_CASE(storage_history)
 //{
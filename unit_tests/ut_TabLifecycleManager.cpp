@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "TabLifecycleManager.h"
+
+using tizen_browser::basic_webengine::TabId;
+using tizen_browser::basic_webengine::webengine_service::TabLifecycleManager;
+
+BOOST_AUTO_TEST_SUITE(tab_lifecycle_manager)
+
+BOOST_AUTO_TEST_CASE(tab_lifecycle_budget)
+{
+    BROWSER_LOGI("[UT] TabLifecycleManager - tab_lifecycle_budget - START --> ");
+
+    TabLifecycleManager lifecycle(3);
+    std::vector<TabId> mostRecentTab;
+    auto activate = [&](int id) {
+        mostRecentTab.push_back(TabId(id));
+        lifecycle.activated(TabId(id));
+    };
+
+    // tab 4 is never shown, so it goes first
+    for (int id = 1; id <= 5; ++id)
+        lifecycle.added(TabId(id));
+    activate(2);
+    activate(1);
+    activate(3);
+    activate(5);
+    BOOST_CHECK(TabLifecycleManager::State::ACTIVE == lifecycle.getState(TabId(5)));
+    BOOST_CHECK(TabLifecycleManager::State::SUSPENDED == lifecycle.getState(TabId(3)));
+    BOOST_CHECK_EQUAL(5u, lifecycle.getLiveTabsCount());
+
+    std::vector<TabId> overBudget = lifecycle.getTabsOverBudget(mostRecentTab);
+    BOOST_REQUIRE_EQUAL(2u, overBudget.size());
+    BOOST_CHECK_EQUAL(4, overBudget[0].get());
+    BOOST_CHECK_EQUAL(2, overBudget[1].get());
+    for (const auto& id : overBudget)
+        lifecycle.discarded(id);
+    BOOST_CHECK_EQUAL(3u, lifecycle.getLiveTabsCount());
+    BOOST_CHECK(lifecycle.getTabsOverBudget(mostRecentTab).empty());
+
+    // active tab is never discarded
+    lifecycle.discarded(TabId(5));
+    BOOST_CHECK(TabLifecycleManager::State::ACTIVE == lifecycle.getState(TabId(5)));
+
+    // restored tab becomes active, the least recently used live tab goes
+    activate(2);
+    overBudget = lifecycle.getTabsOverBudget(mostRecentTab);
+    BOOST_REQUIRE_EQUAL(1u, overBudget.size());
+    BOOST_CHECK_EQUAL(1, overBudget[0].get());
+
+    // on low memory, only the active tab stays
+    std::vector<TabId> suspended = lifecycle.getSuspendedTabs(mostRecentTab);
+    BOOST_REQUIRE_EQUAL(3u, suspended.size());
+    BOOST_CHECK_EQUAL(1, suspended[0].get());
+    BOOST_CHECK_EQUAL(3, suspended[1].get());
+    BOOST_CHECK_EQUAL(5, suspended[2].get());
+
+    lifecycle.removed(TabId(1));
+    BOOST_CHECK(lifecycle.getTabsOverBudget(mostRecentTab).empty());
+
+    // at least one tab is alive
+    lifecycle.setLiveTabsMax(0);
+    BOOST_CHECK_EQUAL(1u, lifecycle.getLiveTabsMax());
+
+    BROWSER_LOGI("[UT] --> END - TabLifecycleManager - tab_lifecycle_budget");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2016 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the License);
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/regex.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "BrowserLogger.h"
+#include "UrlHistoryList/UrlMatchesStyler.h"
+
+using tizen_browser::base_ui::UrlMatchesStyler;
+
+namespace {
+
+const std::string OPEN = "<font_weight=bold><color=#4088D3>";
+const std::string CLOSE = "</font_weight></color=#4088D3>";
+
+std::string wholeUrl(const std::string& url)
+{
+    return "<align=left><color=#888888><font_size=35>" + url + "</color></font></align>";
+}
+
+// previous implementation: regex compiled for every keyword of every row
+// and tags inserted one by one, kept as the benchmark baseline
+std::string legacyHighlight(const std::string& url, const std::string& keywordsString)
+{
+    std::vector<std::string> keywords;
+    boost::algorithm::split(keywords, keywordsString, boost::is_any_of("\t "),
+            boost::token_compress_on);
+    std::vector<std::pair<int, int>> ranges;
+    for (const auto& keyword : keywords) {
+        if (keyword.empty())
+            continue;
+        const std::string lowerUrl(boost::algorithm::to_lower_copy(url));
+        boost::regex regex(boost::algorithm::to_lower_copy(keyword));
+        for (auto it = boost::sregex_iterator(lowerUrl.begin(), lowerUrl.end(), regex);
+                it != boost::sregex_iterator(); ++it)
+            ranges.push_back({it->position(), it->position() + keyword.length() - 1});
+    }
+    std::vector<std::pair<int, int>> merged;
+    std::sort(ranges.begin(), ranges.end());
+    for (const auto& range : ranges)
+        if (!merged.empty() && merged.back().second >= range.first)
+            merged.back().second = std::max(merged.back().second, range.second);
+        else
+            merged.push_back(range);
+    std::string result(url);
+    int offset = 0;
+    for (const auto& range : merged) {
+        result.insert(range.second + offset + 1, CLOSE);
+        result.insert(range.first + offset, OPEN);
+        offset += OPEN.length() + CLOSE.length();
+    }
+    return wholeUrl(result);
+}
+
+} /* namespace */
+
+BOOST_AUTO_TEST_SUITE(url_matches_styler)
+
+BOOST_AUTO_TEST_CASE(styler_highlights_matches)
+{
+    BROWSER_LOGI("[UT] UrlMatchesStyler - styler_highlights_matches - START --> ");
+
+    UrlMatchesStyler styler;
+    // overlapping matches are merged, case is preserved
+    BOOST_CHECK_EQUAL(wholeUrl("http://" + OPEN + "ExAmple" + CLOSE + ".com"),
+            styler.getUrlHighlightedMatches("http://ExAmple.com", "exa ample"));
+    BOOST_CHECK_EQUAL(wholeUrl(OPEN + "a" + CLOSE + "b" + OPEN + "a" + CLOSE),
+            styler.getUrlHighlightedMatches("aba", " a\t"));
+    BOOST_CHECK_EQUAL(wholeUrl("abc"), styler.getUrlHighlightedMatches("abc", ""));
+    // regex special characters are plain text
+    BOOST_CHECK_EQUAL(wholeUrl("a.com/" + OPEN + "?q=(" + CLOSE),
+            styler.getUrlHighlightedMatches("a.com/?q=(", "?q=("));
+
+    BROWSER_LOGI("[UT] --> END - UrlMatchesStyler - styler_highlights_matches");
+}
+
+BOOST_AUTO_TEST_CASE(styler_benchmark)
+{
+    BROWSER_LOGI("[UT] UrlMatchesStyler - styler_benchmark - START --> ");
+
+    const std::size_t ROWS = 100;
+    const std::size_t ROUNDS = 100;
+    const std::string keywords("www example com news 2016");
+    std::vector<std::string> urls;
+    for (std::size_t i = 0; i < ROWS; ++i)
+        urls.push_back("http://www.Example.com/News/2016/" + std::to_string(i)
+                + "/article-about-example-" + std::to_string(i * 31) + ".html");
+
+    UrlMatchesStyler styler;
+    for (const auto& url : urls)
+        BOOST_CHECK_EQUAL(legacyHighlight(url, keywords),
+                styler.getUrlHighlightedMatches(url, keywords));
+
+    using clock = std::chrono::steady_clock;
+    std::size_t length = 0;
+    const auto legacyBegin = clock::now();
+    for (std::size_t round = 0; round < ROUNDS; ++round)
+        for (const auto& url : urls)
+            length += legacyHighlight(url, keywords).length();
+    const auto legacyEnd = clock::now();
+    for (std::size_t round = 0; round < ROUNDS; ++round)
+        for (const auto& url : urls)
+            length -= styler.getUrlHighlightedMatches(url, keywords).length();
+    const auto stylerEnd = clock::now();
+    BOOST_CHECK_EQUAL(0u, length);
+
+    using micros = std::chrono::duration<double, std::micro>;
+    const double rows = ROWS * ROUNDS;
+    const double legacyRow = micros(legacyEnd - legacyBegin).count() / rows;
+    const double stylerRow = micros(stylerEnd - legacyEnd).count() / rows;
+    BOOST_TEST_MESSAGE("5 keywords, per row: regex " << legacyRow
+            << "us, single pass " << stylerRow << "us");
+
+    BROWSER_LOGI("[UT] --> END - UrlMatchesStyler - styler_benchmark");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
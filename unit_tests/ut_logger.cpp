@@ -17,6 +17,8 @@
 #include <cassert>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -134,6 +136,52 @@ BOOST_AUTO_TEST_CASE(logger_init) {
         BROWSER_LOGI("[UT] --> END - LOGGER - logger_init");
 }
 
+BOOST_AUTO_TEST_CASE(logger_post) {
+        BROWSER_LOGI("[UT] LOGGER - logger_post - START --> ");
+
+	using tizen_browser::logger::Logger;
+	using tizen_browser::logger::LoggerLevel;
+
+	StubLogger logger;
+	StubAbstractLogger *l = new StubAbstractLogger;
+	logger.registerLogger(l);
+
+	// messages posted before init() are passed on flush()
+	logger.post(LoggerLevel::INFO, "%s %d", "Bla", 1);
+	logger.flush();
+	std::string checker = l->getLog();
+	checker.erase(checker.begin(), std::find(checker.begin(), checker.end(), ']') + 1);
+	boost::algorithm::trim(checker);
+	BOOST_CHECK_EQUAL(checker, "Bla 1");
+
+	// messages posted by many threads are passed by the logger thread
+	logger.init();
+	const int threads = 4;
+	const int messages = 100;
+	std::vector<std::thread> posters;
+	for (int i = 0; i < threads; ++i) {
+		posters.emplace_back([&logger]() {
+			for (int j = 0; j < messages; ++j) {
+				logger.post(LoggerLevel::DEBUG, "message %d", j);
+			}
+		});
+	}
+	for (auto &poster : posters) {
+		poster.join();
+	}
+	logger.flush();
+	std::string log = l->getLog();
+	BOOST_CHECK_EQUAL(std::count(log.begin(), log.end(), '\n'), 1 + threads * messages);
+
+	Logger::setLevel(LoggerLevel::WARN);
+	BOOST_CHECK(!Logger::isEnabled(LoggerLevel::INFO));
+	BOOST_CHECK(Logger::isEnabled(LoggerLevel::ERROR));
+	Logger::setLevel(LoggerLevel::DEBUG);
+	BOOST_CHECK(Logger::isEnabled(LoggerLevel::DEBUG));
+
+        BROWSER_LOGI("[UT] --> END - LOGGER - logger_post");
+}
+
 ///\todo p.chmielewski
 /*
 BOOST_AUTO_TEST_CASE(logger_levels_getting) {